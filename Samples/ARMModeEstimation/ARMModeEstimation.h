@@ -0,0 +1,42 @@
+//
+// Hopper Disassembler SDK
+//
+// (c) Cryptic Apps SARL. All Rights Reserved.
+// https://www.hopperapp.com
+//
+// THIS CODE AND INFORMATION ARE PROVIDED "AS IS" WITHOUT WARRANTY OF ANY
+// KIND, EITHER EXPRESSED OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND/OR FITNESS FOR A
+// PARTICULAR PURPOSE.
+//
+
+#import <Foundation/Foundation.h>
+#import <Hopper/CommonTypes.h>
+
+// Reference implementation of the "estimateCPUModesForRange:" method of
+// CPUContext, for an ARM/Thumb CPU, using the Capstone ARM module.
+//
+// This is example code, to be copied into an ARM CPU plugin. It is built by the
+// ARMModeEstimation target of Samples/Linux/GNUmakefile, with the Capstone copy
+// of the M68kCPU sample, which also contains the ARM module: the plugin has to
+// compile Capstone with CAPSTONE_HAS_ARM.
+//
+// The bytes are decoded in a single pass, in ARM mode and in Thumb mode. Each
+// 4 bytes granule gets a score for both modes, and the mode of a granule is the
+// one with the best score over a sliding window centered on it. A CPUContext
+// would call it on the mapped data of the range:
+//
+//   - (NSArray<NSValue *> *)estimateCPUModesForRange:(AddressRange)range {
+//       ... find the mapped bytes of the range ...
+//       return ARMEstimateCPUModes(bytes, range.len, range.from);
+//   }
+
+#define ARM_MODE_ESTIMATION_ARM         0
+#define ARM_MODE_ESTIMATION_THUMB       1
+
+// Size of the sliding window, in 4 bytes granules.
+#define ARM_MODE_ESTIMATION_WINDOW      16
+
+// Returns the run-length map of the estimated modes, as NSValue objects
+// holding a CPUModeRun, sorted by address. Code is expected to be little endian.
+NSArray<NSValue *> *ARMEstimateCPUModes(const uint8_t *bytes, size_t length, Address address);
@@ -0,0 +1,117 @@
+//
+// Hopper Disassembler SDK
+//
+// (c) Cryptic Apps SARL. All Rights Reserved.
+// https://www.hopperapp.com
+//
+// THIS CODE AND INFORMATION ARE PROVIDED "AS IS" WITHOUT WARRANTY OF ANY
+// KIND, EITHER EXPRESSED OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND/OR FITNESS FOR A
+// PARTICULAR PURPOSE.
+//
+
+#import "ARMModeEstimation.h"
+#import <capstone/capstone.h>
+
+// Decode one instruction, and return its score. "size" receives the number of bytes
+// to skip: the size of the instruction, or the minimal one when it fails to decode.
+static int32_t scoreInstruction(csh handle, cs_insn *insn, const uint8_t *bytes, size_t available, Address address, BOOL isARM, size_t *size) {
+    const uint8_t *code = bytes;
+    uint64_t pc = address;
+    *size = isARM ? 4 : 2;
+    if (!cs_disasm_iter(handle, &code, &available, &pc, insn)) return 0;
+    *size = insn->size;
+
+    uint32_t word = 0;
+    memcpy(&word, bytes, insn->size < 4 ? insn->size : 4);
+    if (word == 0) return 0;
+
+    // Zeroes decode in both modes, and tell nothing. Both modes score about 4 for
+    // a granule of their own code: a Thumb instruction scores its size, and an ARM
+    // instruction covers the whole granule. Most ARM instructions are unconditional,
+    // and Thumb code rarely looks like one: they get a bonus, while the conditional
+    // ones score a bit less than the Thumb instructions they would also decode as.
+    // The high half of an unconditional ARM instruction decodes as a Thumb "b",
+    // which scores nothing, and the ARM unconditional space (0xF) is rarely used.
+    if (isARM) {
+        switch (word >> 28) {
+            case 0xE: return 6;
+            case 0xF: return 0;
+            default:  return 3;
+        }
+    }
+    if (insn->size == 2 && (word & 0xF800) == 0xE000) return 0;
+    return insn->size;
+}
+
+static void appendRun(NSMutableArray<NSValue *> *runs, Address from, size_t len, uint8_t mode) {
+    CPUModeRun run = { { from, len }, mode };
+    [runs addObject:[NSValue valueWithBytes:&run objCType:@encode(CPUModeRun)]];
+}
+
+NSArray<NSValue *> *ARMEstimateCPUModes(const uint8_t *bytes, size_t length, Address address) {
+    NSMutableArray<NSValue *> *runs = [NSMutableArray array];
+    size_t granules = length / 4;
+    if (granules == 0) {
+        if (length) appendRun(runs, address, length, ARM_MODE_ESTIMATION_ARM);
+        return runs;
+    }
+
+    csh armHandle, thumbHandle;
+    if (cs_open(CS_ARCH_ARM, CS_MODE_ARM, &armHandle) != CS_ERR_OK) return runs;
+    if (cs_open(CS_ARCH_ARM, CS_MODE_THUMB, &thumbHandle) != CS_ERR_OK) {
+        cs_close(&armHandle);
+        return runs;
+    }
+
+    // Prefix sum of the score of the ARM mode minus the score of the Thumb mode,
+    // per granule, used to compute the window sums.
+    int64_t *prefix = malloc((granules + 1) * sizeof(int64_t));
+    cs_insn *armInsn = cs_malloc(armHandle);
+    cs_insn *thumbInsn = cs_malloc(thumbHandle);
+    if (prefix && armInsn && thumbInsn) {
+        // Both modes are scored in a single pass over the bytes: the ARM instruction
+        // of each granule, then the Thumb instructions which start in it. The Thumb
+        // instructions are decoded one after the other, as a linear stream.
+        size_t codeLength = granules * 4;
+        size_t thumbOffset = 0;
+        prefix[0] = 0;
+        for (size_t i=0; i<granules; i++) {
+            size_t size;
+            int32_t score = scoreInstruction(armHandle, armInsn, bytes + i * 4, 4, address + i * 4, YES, &size);
+            while (thumbOffset < (i + 1) * 4) {
+                score -= scoreInstruction(thumbHandle, thumbInsn, bytes + thumbOffset, codeLength - thumbOffset, address + thumbOffset, NO, &size);
+                thumbOffset += size;
+            }
+            prefix[i + 1] = prefix[i] + score;
+        }
+
+        Address runStart = address;
+        uint8_t runMode = ARM_MODE_ESTIMATION_ARM;
+        for (size_t i=0; i<granules; i++) {
+            size_t lo = (i >= ARM_MODE_ESTIMATION_WINDOW / 2) ? i - ARM_MODE_ESTIMATION_WINDOW / 2 : 0;
+            size_t hi = MIN(granules, i + ARM_MODE_ESTIMATION_WINDOW / 2 + 1);
+            uint8_t mode = (prefix[hi] - prefix[lo] >= 0) ? ARM_MODE_ESTIMATION_ARM : ARM_MODE_ESTIMATION_THUMB;
+            if (i == 0) {
+                runMode = mode;
+            }
+            else if (mode != runMode) {
+                Address granuleAddress = address + i * 4;
+                appendRun(runs, runStart, (size_t) (granuleAddress - runStart), runMode);
+                runStart = granuleAddress;
+                runMode = mode;
+            }
+        }
+
+        // The last run also covers the bytes after the last granule.
+        appendRun(runs, runStart, (size_t) (address + length - runStart), runMode);
+    }
+
+    free(prefix);
+    if (armInsn) cs_free(armInsn, 1);
+    if (thumbInsn) cs_free(thumbInsn, 1);
+    cs_close(&armHandle);
+    cs_close(&thumbHandle);
+
+    return runs;
+}
@@ -52,6 +52,310 @@ typedef NS_ENUM(uint32_t, HUNK_TYPE) {
     HUNK_RELRELOC26 = 1260
 };
 
+// Known addresses of the CIA chips and of the custom chips registers.
+
+typedef struct {
+    Address address;
+    const char *name;
+    const char *inlineComment;  // NULL if none
+} AmigaKnownAddress;
+
+static const AmigaKnownAddress amigaCIARegisters[] = {
+    { 0xBFE001, "CIAA_pra",    NULL },
+    { 0xBFE101, "CIAA_prb",    NULL },
+    { 0xBFE201, "CIAA_ddra",   NULL },
+    { 0xBFE301, "CIAA_ddrb",   NULL },
+    { 0xBFE401, "CIAA_talo",   NULL },
+    { 0xBFE501, "CIAA_tahi",   NULL },
+    { 0xBFE601, "CIAA_tblo",   NULL },
+    { 0xBFE701, "CIAA_tbhi",   NULL },
+    { 0xBFE801, "CIAA_todlo",  NULL },
+    { 0xBFE901, "CIAA_todmid", NULL },
+    { 0xBFEA01, "CIAA_todhi",  NULL },
+    { 0xBFEC01, "CIAA_sdr",    NULL },
+    { 0xBFED01, "CIAA_icr",    NULL },
+    { 0xBFEE01, "CIAA_cra",    NULL },
+    { 0xBFEF01, "CIAA_crb",    NULL },
+    { 0xBFD000, "CIAB_pra",    NULL },
+    { 0xBFD100, "CIAB_prb",    NULL },
+    { 0xBFD200, "CIAB_ddra",   NULL },
+    { 0xBFD300, "CIAB_ddrb",   NULL },
+    { 0xBFD400, "CIAB_talo",   NULL },
+    { 0xBFD500, "CIAB_tahi",   NULL },
+    { 0xBFD600, "CIAB_tblo",   NULL },
+    { 0xBFD700, "CIAB_tbhi",   NULL },
+    { 0xBFD800, "CIAB_todlo",  NULL },
+    { 0xBFD900, "CIAB_todmid", NULL },
+    { 0xBFDA00, "CIAB_todhi",  NULL },
+    { 0xBFDC00, "CIAB_sdr",    NULL },
+    { 0xBFDD00, "CIAB_icr",    NULL },
+    { 0xBFDE00, "CIAB_cra",    NULL },
+    { 0xBFDF00, "CIAB_crb",    NULL },
+};
+
+static const AmigaKnownAddress amigaCustomRegisters[] = {
+    { 0xDFF000, "BLTDDAT",  "Blitter dest. early read (dummy address)" },
+    { 0xDFF002, "DMACONR",  "Dma control (and blitter status) read" },
+    { 0xDFF004, "VPOSR",    "Read vertical most sig. bits (and frame flop)" },
+    { 0xDFF006, "VHPOSR",   "Read vert and horiz position of beam" },
+    { 0xDFF008, "DSKDATR",  "Disk data early read (dummy address)" },
+    { 0xDFF00A, "JOY0DAT",  "Joystick-mouse 0 data (vert, horiz)" },
+    { 0xDFF00C, "JOY1DAT",  "Joystick-mouse 1 data (vert, horiz)" },
+    { 0xDFF00E, "CLXDAT",   "Collision data reg. (read and clear)" },
+    { 0xDFF010, "ADKCONR",  "Audio,disk control register read" },
+    { 0xDFF012, "POT0DAT",  "Pot counter data left pair (vert, horiz)" },
+    { 0xDFF014, "POT1DAT",  "Pot counter data right pair (vert, horiz)" },
+    { 0xDFF016, "POTINP",   "Pot pin data read" },
+    { 0xDFF018, "SERDATR",  "Serial port data and status read" },
+    { 0xDFF01A, "DSKBYTR",  "Disk data byte and status read" },
+    { 0xDFF01C, "INTENAR",  "Interrupt enable bits read" },
+    { 0xDFF01E, "INTREQR",  "Interrupt request bits read" },
+    { 0xDFF020, "DSKPTH",   "Disk pointer (high 5 bits, was 3 bits)" },
+    { 0xDFF022, "DSKPTL",   "Disk pointer (low 15 bits)" },
+    { 0xDFF024, "DSKLEN",   "Disk length" },
+    { 0xDFF026, "DSKDAT",   "Disk DMA data write" },
+    { 0xDFF028, "REFPTR",   "Refresh pointer" },
+    { 0xDFF02A, "VPOSW",    "Write vert most sig. bits (and frame flop)" },
+    { 0xDFF02C, "VHPOSW",   "Write vert and horiz pos of beam" },
+    { 0xDFF02E, "COPCON",   "Coprocessor control" },
+    { 0xDFF030, "SERDAT",   "Serial port data and stop bits write" },
+    { 0xDFF032, "SERPER",   "Serial port period and control" },
+    { 0xDFF034, "POTGO",    "Pot count start,pot pin drive enable data" },
+    { 0xDFF036, "JOYTEST",  "Write to all 4 joystick-mouse counters at once" },
+    { 0xDFF038, "STREQU",   "Strobe for horiz sync with VB and EQU" },
+    { 0xDFF03A, "STRVBL",   "Strobe for horiz sync with VB (vert blank)" },
+    { 0xDFF03C, "STRHOR",   "Strobe for horiz sync" },
+    { 0xDFF03E, "STRLONG",  "Strobe for identification of long horiz line" },
+    { 0xDFF040, "BLTCON0",  "Blitter control register 0" },
+    { 0xDFF042, "BLTCON1",  "Blitter control register 1" },
+    { 0xDFF044, "BLTAFWM",  "Blitter first word mask for source A" },
+    { 0xDFF046, "BLTALWM",  "Blitter last word mask for source A" },
+    { 0xDFF048, "BLTCPTH",  "Blitter pointer to source C (high 5 bits, was 3 bits)" },
+    { 0xDFF04A, "BLTCPTL",  "Blitter pointer to source C (low 15 bits)" },
+    { 0xDFF04C, "BLTBPTH",  "Blitter pointer to source B (high 5 bits, was 3 bits)" },
+    { 0xDFF04E, "BLTBPTL",  "Blitter pointer to source B (low 15 bits)" },
+    { 0xDFF050, "BLTAPTH",  "Blitter pointer to source A (high 5 bits, was 3 bits)" },
+    { 0xDFF052, "BLTAPTL",  "Blitter pointer to source A (low 15 bits)" },
+    { 0xDFF054, "BLTDPTH",  "Blitter pointer to dest D (high 5 bits, was 3 bits)" },
+    { 0xDFF056, "BLTDPTL",  "Blitter pointer to dest D (low 15 bits)" },
+    { 0xDFF058, "BLTSIZE",  "Blitter start and size (win/width,height)" },
+    { 0xDFF05A, "BLTCON0L", "Blitter control 0, lower 8 bits (minterms)" },
+    { 0xDFF05C, "BLTSIZV",  "Blitter V size (for 15 bit vertical size)" },
+    { 0xDFF05E, "BLTSIZH",  "Blitter H size and start (for 11 bit H size)" },
+    { 0xDFF060, "BLTCMOD",  "Blitter modulo for source C" },
+    { 0xDFF062, "BLTBMOD",  "Blitter modulo for source B" },
+    { 0xDFF064, "BLTAMOD",  "Blitter modulo for source A" },
+    { 0xDFF066, "BLTDMOD",  "Blitter modulo for dest D" },
+    { 0xDFF070, "BLTCDAT",  "Blitter source C data register" },
+    { 0xDFF072, "BLTBDAT",  "Blitter source B data register" },
+    { 0xDFF074, "BLTADAT",  "Blitter source A data register" },
+    { 0xDFF078, "SPRHDAT",  "Ext. logic UHRES sprite pointer and data identifier" },
+    { 0xDFF07A, "BPLHDAT",  "Ext. logic UHRES bit plane identifier" },
+    { 0xDFF07C, "DENISEID", "Chip revision level for Denise/Lisa (video out chip)" },
+    { 0xDFF07E, "DSKSYNC",  "Disk sync pattern reg for disk read" },
+    { 0xDFF080, "COP1LCH",  "Coprocessor 1st location (high 5 bits,was 3 bits)" },
+    { 0xDFF082, "COP1LCL",  "Coprocessor 1st location (low 15 bits)" },
+    { 0xDFF084, "COP2LCH",  "Coprocessor 2nd location(high 5 bits,was 3 bits)" },
+    { 0xDFF086, "COP2LCL",  "Coprocessor 2nd location (low 15 bits)" },
+    { 0xDFF088, "COPJMP1",  "Coprocessor restart at 1st location" },
+    { 0xDFF08A, "COPJMP2",  "Coprocessor restart at 2nd location" },
+    { 0xDFF08C, "COPINS",   "Coprocessor inst fetch identify" },
+    { 0xDFF08E, "DIWSTRT",  "Display window start (upper left vert,horiz pos)" },
+    { 0xDFF090, "DIWSTOP",  "Display window stop (lower right vert,horiz pos)" },
+    { 0xDFF092, "DDFSTRT",  "Display bit plane data fetch start,horiz pos" },
+    { 0xDFF094, "DDFSTOP",  "Display bit plane data fetch stop,horiz pos" },
+    { 0xDFF096, "DMACON",   "DMA control write (clear or set)" },
+    { 0xDFF098, "CLXCON",   "Collision control" },
+    { 0xDFF09A, "INTENA",   "Interrupt enable bits (clear or set bits)" },
+    { 0xDFF09C, "INTREQ",   "Interrupt request bits (clear or set bits)" },
+    { 0xDFF09E, "ADKCON",   "Audio,disk,UART control" },
+    { 0xDFF0A0, "AUD0LCH",  "Audio channel 0 location (high 5 bits was 3 bits)" },
+    { 0xDFF0A2, "AUD0LCL",  "Audio channel 0 location (low 15 bits)" },
+    { 0xDFF0A4, "AUD0LEN",  "Audio channel 0 length" },
+    { 0xDFF0A6, "AUD0PER",  "Audio channel 0 period" },
+    { 0xDFF0A8, "AUD0VOL",  "Audio channel 0 volume" },
+    { 0xDFF0AA, "AUD0DAT",  "Audio channel 0 data" },
+    { 0xDFF0B0, "AUD1LCH",  "Audio channel 1 location (high 5 bits was 3 bits)" },
+    { 0xDFF0B2, "AUD1LCL",  "Audio channel 1 location (low 15 bits)" },
+    { 0xDFF0B4, "AUD1LEN",  "Audio channel 1 length" },
+    { 0xDFF0B6, "AUD1PER",  "Audio channel 1 period" },
+    { 0xDFF0B8, "AUD1VOL",  "Audio channel 1 volume" },
+    { 0xDFF0BA, "AUD1DAT",  "Audio channel 1 data" },
+    { 0xDFF0C0, "AUD2LCH",  "Audio channel 2 location (high 5 bits was 3 bits)" },
+    { 0xDFF0C2, "AUD2LCL",  "Audio channel 2 location (low 15 bits)" },
+    { 0xDFF0C4, "AUD2LEN",  "Audio channel 2 length" },
+    { 0xDFF0C6, "AUD2PER",  "Audio channel 2 period" },
+    { 0xDFF0C8, "AUD2VOL",  "Audio channel 2 volume" },
+    { 0xDFF0CA, "AUD2DAT",  "Audio channel 2 data" },
+    { 0xDFF0D0, "AUD3LCH",  "Audio channel 3 location (high 5 bits was 3 bits)" },
+    { 0xDFF0D2, "AUD3LCL",  "Audio channel 3 location (low 15 bits)" },
+    { 0xDFF0D4, "AUD3LEN",  "Audio channel 3 length" },
+    { 0xDFF0D6, "AUD3PER",  "Audio channel 3 period" },
+    { 0xDFF0D8, "AUD3VOL",  "Audio channel 3 volume" },
+    { 0xDFF0DA, "AUD3DAT",  "Audio channel 3 data" },
+    { 0xDFF0E0, "BPL1PTH",  "Bitplane pointer 1 (high 5 bits was 3 bits)" },
+    { 0xDFF0E2, "BPL1PTL",  "Bitplane pointer 1 (low 15 bits)" },
+    { 0xDFF0E4, "BPL2PTH",  "Bitplane pointer 2 (high 5 bits was 3 bits)" },
+    { 0xDFF0E6, "BPL2PTL",  "Bitplane pointer 2 (low 15 bits)" },
+    { 0xDFF0E8, "BPL3PTH",  "Bitplane pointer 3 (high 5 bits was 3 bits)" },
+    { 0xDFF0EA, "BPL3PTL",  "Bitplane pointer 3 (low 15 bits)" },
+    { 0xDFF0EC, "BPL4PTH",  "Bitplane pointer 4 (high 5 bits was 3 bits)" },
+    { 0xDFF0EE, "BPL4PTL",  "Bitplane pointer 4 (low 15 bits)" },
+    { 0xDFF0F0, "BPL5PTH",  "Bitplane pointer 5 (high 5 bits was 3 bits)" },
+    { 0xDFF0F2, "BPL5PTL",  "Bitplane pointer 5 (low 15 bits)" },
+    { 0xDFF0F4, "BPL6PTH",  "Bitplane pointer 6 (high 5 bits was 3 bits)" },
+    { 0xDFF0F6, "BPL6PTL",  "Bitplane pointer 6 (low 15 bits)" },
+    { 0xDFF0F8, "BPL7PTH",  "pointer 7 (high 5 bits was 3 bits)" },
+    { 0xDFF0FA, "BPL7PTL",  "pointer 7 (low 15 bits)" },
+    { 0xDFF0FC, "BPL8PTH",  "pointer 8 (high 5 bits was 3 bits)" },
+    { 0xDFF0FE, "BPL8PTL",  "pointer 8 (low 15 bits)" },
+    { 0xDFF100, "BPLCON0",  "Bitplane control (miscellaneous control bits)" },
+    { 0xDFF102, "BPLCON1",  "Bitplane control (scroll value)" },
+    { 0xDFF104, "BPLCON2",  "Bitplane control (video priority control)" },
+    { 0xDFF106, "BPLCON3",  "Bitplane control (enhanced features)" },
+    { 0xDFF108, "BPL1MOD",  "Bitplane modulo (odd planes)" },
+    { 0xDFF10A, "BPL2MOD",  "Bitplane modulo (even planes)" },
+    { 0xDFF10C, "BPLCON4",  "control (bitplane and sprite-masks)" },
+    { 0xDFF10E, "CLXCON2",  "collision control" },
+    { 0xDFF110, "BPL1DAT",  "Bitplane 1 data (parallel to serial convert)" },
+    { 0xDFF112, "BPL2DAT",  "Bitplane 2 data (parallel to serial convert)" },
+    { 0xDFF114, "BPL3DAT",  "Bitplane 3 data (parallel to serial convert)" },
+    { 0xDFF116, "BPL4DAT",  "Bitplane 4 data (parallel to serial convert)" },
+    { 0xDFF118, "BPL5DAT",  "Bitplane 5 data (parallel to serial convert)" },
+    { 0xDFF11A, "BPL6DAT",  "Bitplane 6 data (parallel to serial convert)" },
+    { 0xDFF11C, "BPL7DAT",  "7 data (parallel to serial convert)" },
+    { 0xDFF11E, "BPL8DAT",  "8 data (parallel to serial convert)" },
+    { 0xDFF120, "SPR0PTH",  "Sprite 0 pointer (high 5 bits was 3 bits)" },
+    { 0xDFF122, "SPR0PTL",  "Sprite 0 pointer (low 15 bits)" },
+    { 0xDFF124, "SPR1PTH",  "Sprite 1 pointer (high 5 bits was 3 bits)" },
+    { 0xDFF126, "SPR1PTL",  "Sprite 1 pointer (low 15 bits)" },
+    { 0xDFF128, "SPR2PTH",  "Sprite 2 pointer (high 5 bits was 3 bits)" },
+    { 0xDFF12A, "SPR2PTL",  "Sprite 2 pointer (low 15 bits)" },
+    { 0xDFF12C, "SPR3PTH",  "Sprite 3 pointer (high 5 bits was 3 bits)" },
+    { 0xDFF12E, "SPR3PTL",  "Sprite 3 pointer (low 15 bits)" },
+    { 0xDFF130, "SPR4PTH",  "Sprite 4 pointer (high 5 bits was 3 bits)" },
+    { 0xDFF132, "SPR4PTL",  "Sprite 4 pointer (low 15 bits)" },
+    { 0xDFF134, "SPR5PTH",  "Sprite 5 pointer (high 5 bits was 3 bits)" },
+    { 0xDFF136, "SPR5PTL",  "Sprite 5 pointer (low 15 bits)" },
+    { 0xDFF138, "SPR6PTH",  "Sprite 6 pointer (high 5 bits was 3 bits)" },
+    { 0xDFF13A, "SPR6PTL",  "Sprite 6 pointer (low 15 bits)" },
+    { 0xDFF13C, "SPR7PTH",  "Sprite 7 pointer (high 5 bits was 3 bits)" },
+    { 0xDFF13E, "SPR7PTL",  "Sprite 7 pointer (low 15 bits)" },
+    { 0xDFF140, "SPR0POS",  "Sprite 0 vert,horiz start pos data" },
+    { 0xDFF142, "SPR0CTL",  "Sprite 0 position and control data" },
+    { 0xDFF144, "SPR0DATA", "Sprite 0 image data register A" },
+    { 0xDFF146, "SPR0DATB", "Sprite 0 image data register B" },
+    { 0xDFF148, "SPR1POS",  "Sprite 1 vert,horiz start pos data" },
+    { 0xDFF14A, "SPR1CTL",  "Sprite 1 position and control data" },
+    { 0xDFF14C, "SPR1DATA", "Sprite 1 image data register A" },
+    { 0xDFF14E, "SPR1DATB", "Sprite 1 image data register B" },
+    { 0xDFF150, "SPR2POS",  "Sprite 2 vert,horiz start pos data" },
+    { 0xDFF152, "SPR2CTL",  "Sprite 2 position and control data" },
+    { 0xDFF154, "SPR2DATA", "Sprite 2 image data register A" },
+    { 0xDFF156, "SPR2DATB", "Sprite 2 image data register B" },
+    { 0xDFF158, "SPR3POS",  "Sprite 3 vert,horiz start pos data" },
+    { 0xDFF15A, "SPR3CTL",  "Sprite 3 position and control data" },
+    { 0xDFF15C, "SPR3DATA", "Sprite 3 image data register A" },
+    { 0xDFF15E, "SPR3DATB", "Sprite 3 image data register B" },
+    { 0xDFF160, "SPR4POS",  "Sprite 4 vert,horiz start pos data" },
+    { 0xDFF162, "SPR4CTL",  "Sprite 4 position and control data" },
+    { 0xDFF164, "SPR4DATA", "Sprite 4 image data register A" },
+    { 0xDFF166, "SPR4DATB", "Sprite 4 image data register B" },
+    { 0xDFF168, "SPR5POS",  "Sprite 5 vert,horiz start pos data" },
+    { 0xDFF16A, "SPR5CTL",  "Sprite 5 position and control data" },
+    { 0xDFF16C, "SPR5DATA", "Sprite 5 image data register A" },
+    { 0xDFF16E, "SPR5DATB", "Sprite 5 image data register B" },
+    { 0xDFF170, "SPR6POS",  "Sprite 6 vert,horiz start pos data" },
+    { 0xDFF172, "SPR6CTL",  "Sprite 6 position and control data" },
+    { 0xDFF174, "SPR6DATA", "Sprite 6 image data register A" },
+    { 0xDFF176, "SPR6DATB", "Sprite 6 image data register B" },
+    { 0xDFF178, "SPR7POS",  "Sprite 7 vert,horiz start pos data" },
+    { 0xDFF17A, "SPR7CTL",  "Sprite 7 position and control data" },
+    { 0xDFF17C, "SPR7DATA", "Sprite 7 image data register A" },
+    { 0xDFF17E, "SPR7DATB", "Sprite 7 image data register B" },
+    { 0xDFF180, "COLOR00",  "Color table 0" },
+    { 0xDFF182, "COLOR01",  "Color table 1" },
+    { 0xDFF184, "COLOR02",  "Color table 2" },
+    { 0xDFF186, "COLOR03",  "Color table 3" },
+    { 0xDFF188, "COLOR04",  "Color table 4" },
+    { 0xDFF18A, "COLOR05",  "Color table 5" },
+    { 0xDFF18C, "COLOR06",  "Color table 6" },
+    { 0xDFF18E, "COLOR07",  "Color table 7" },
+    { 0xDFF190, "COLOR08",  "Color table 8" },
+    { 0xDFF192, "COLOR09",  "Color table 9" },
+    { 0xDFF194, "COLOR10",  "Color table 10" },
+    { 0xDFF196, "COLOR11",  "Color table 11" },
+    { 0xDFF198, "COLOR12",  "Color table 12" },
+    { 0xDFF19A, "COLOR13",  "Color table 13" },
+    { 0xDFF19C, "COLOR14",  "Color table 14" },
+    { 0xDFF19E, "COLOR15",  "Color table 15" },
+    { 0xDFF1A0, "COLOR16",  "Color table 16" },
+    { 0xDFF1A2, "COLOR17",  "Color table 17" },
+    { 0xDFF1A4, "COLOR18",  "Color table 18" },
+    { 0xDFF1A6, "COLOR19",  "Color table 19" },
+    { 0xDFF1A8, "COLOR20",  "Color table 20" },
+    { 0xDFF1AA, "COLOR21",  "Color table 21" },
+    { 0xDFF1AC, "COLOR22",  "Color table 22" },
+    { 0xDFF1AE, "COLOR23",  "Color table 23" },
+    { 0xDFF1B0, "COLOR24",  "Color table 24" },
+    { 0xDFF1B2, "COLOR25",  "Color table 25" },
+    { 0xDFF1B4, "COLOR26",  "Color table 26" },
+    { 0xDFF1B6, "COLOR27",  "Color table 27" },
+    { 0xDFF1B8, "COLOR28",  "Color table 28" },
+    { 0xDFF1BA, "COLOR29",  "Color table 29" },
+    { 0xDFF1BC, "COLOR30",  "Color table 30" },
+    { 0xDFF1BE, "COLOR31",  "Color table 31" },
+    { 0xDFF1C0, "HTOTAL",   "Highest number count, horiz line (VARBEAMEN=1)" },
+    { 0xDFF1C2, "HSSTOP",   "Horizontal line position for HSYNC stop" },
+    { 0xDFF1C4, "HBSTRT",   "Horizontal line position for HBLANK start" },
+    { 0xDFF1C6, "HBSTOP",   "Horizontal line position for HBLANK stop" },
+    { 0xDFF1C8, "VTOTAL",   "Highest numbered vertical line (VARBEAMEN=1)" },
+    { 0xDFF1CA, "VSSTOP",   "Vertical line position for VSYNC stop" },
+    { 0xDFF1CC, "VBSTRT",   "Vertical line for VBLANK start" },
+    { 0xDFF1CE, "VBSTOP",   "Vertical line for VBLANK stop" },
+    { 0xDFF1D0, "SPRHSTRT", "UHRES sprite vertical start" },
+    { 0xDFF1D2, "SPRHSTOP", "UHRES sprite vertical stop" },
+    { 0xDFF1D4, "BPLHSTRT", "UHRES bit plane vertical start" },
+    { 0xDFF1D6, "BPLHSTOP", "UHRES bit plane vertical stop" },
+    { 0xDFF1D8, "HHPOSW",   "DUAL mode hires H beam counter write" },
+    { 0xDFF1DA, "HHPOSR",   "DUAL mode hires H beam counter read" },
+    { 0xDFF1DC, "BEAMCON0", "Beam counter control register (SHRES,UHRES,PAL)" },
+    { 0xDFF1DE, "HSSTRT",   "Horizontal sync start (VARHSY)" },
+    { 0xDFF1E0, "VSSTRT",   "Vertical sync start (VARVSY)" },
+    { 0xDFF1E2, "HCENTER",  "Horizontal position for Vsync on interlace" },
+    { 0xDFF1E4, "DIWHIGH",  "Display window - upper bits for start/stop" },
+    { 0xDFF1E6, "BPLHMOD",  "UHRES bit plane modulo" },
+    { 0xDFF1E8, "SPRHPTH",  "UHRES sprite pointer (high 5 bits)" },
+    { 0xDFF1EA, "SPRHPTL",  "UHRES sprite pointer (low 15 bits)" },
+    { 0xDFF1EC, "BPLHPTH",  "VRam (UHRES) bitplane pointer (hi 5 bits)" },
+    { 0xDFF1EE, "BPLHPTL",  "VRam (UHRES) bitplane pointer (lo 15 bits)" },
+    { 0xDFF1FC, "FMODE",    "mode register" },
+};
+
+// Name the addresses of a table, and set their inline comments, with a single bulk call for each.
+static void addKnownAddresses(NSObject<HPDisassembledFile> *file, const AmigaKnownAddress *table, size_t count) {
+    Address *addresses = malloc(count * sizeof(Address));
+    Address *commentAddresses = malloc(count * sizeof(Address));
+    NSMutableArray<NSString *> *names = [NSMutableArray arrayWithCapacity:count];
+    NSMutableArray<NSString *> *comments = [NSMutableArray arrayWithCapacity:count];
+    for (size_t i=0; i<count; i++) {
+        addresses[i] = table[i].address;
+        [names addObject:@(table[i].name)];
+        if (table[i].inlineComment) {
+            commentAddresses[comments.count] = table[i].address;
+            [comments addObject:@(table[i].inlineComment)];
+        }
+    }
+
+    [file setNames:names forAddresses:addresses count:count reason:NCReason_Automatic];
+    if (comments.count) {
+        [file setInlineComments:comments atAddresses:commentAddresses count:comments.count reason:CCReason_Automatic];
+    }
+
+    free(addresses);
+    free(commentAddresses);
+}
+
 @implementation AmigaLoader {
     NSObject<HPHopperServices> *_services;
 }
@@ -258,274 +562,8 @@ typedef NS_ENUM(uint32_t, HUNK_TYPE) {
     [file addSegmentAt:0xDFF000 size:0x1000].segmentName = @"Custom";
 
     // Add some known address
-    [file setName:@"CIAA_pra"    forVirtualAddress:0xBFE001 reason:NCReason_Automatic];
-    [file setName:@"CIAA_prb"    forVirtualAddress:0xBFE101 reason:NCReason_Automatic];
-    [file setName:@"CIAA_ddra"   forVirtualAddress:0xBFE201 reason:NCReason_Automatic];
-    [file setName:@"CIAA_ddrb"   forVirtualAddress:0xBFE301 reason:NCReason_Automatic];
-    [file setName:@"CIAA_talo"   forVirtualAddress:0xBFE401 reason:NCReason_Automatic];
-    [file setName:@"CIAA_tahi"   forVirtualAddress:0xBFE501 reason:NCReason_Automatic];
-    [file setName:@"CIAA_tblo"   forVirtualAddress:0xBFE601 reason:NCReason_Automatic];
-    [file setName:@"CIAA_tbhi"   forVirtualAddress:0xBFE701 reason:NCReason_Automatic];
-    [file setName:@"CIAA_todlo"  forVirtualAddress:0xBFE801 reason:NCReason_Automatic];
-    [file setName:@"CIAA_todmid" forVirtualAddress:0xBFE901 reason:NCReason_Automatic];
-    [file setName:@"CIAA_todhi"  forVirtualAddress:0xBFEA01 reason:NCReason_Automatic];
-    [file setName:@"CIAA_sdr"    forVirtualAddress:0xBFEC01 reason:NCReason_Automatic];
-    [file setName:@"CIAA_icr"    forVirtualAddress:0xBFED01 reason:NCReason_Automatic];
-    [file setName:@"CIAA_cra"    forVirtualAddress:0xBFEE01 reason:NCReason_Automatic];
-    [file setName:@"CIAA_crb"    forVirtualAddress:0xBFEF01 reason:NCReason_Automatic];
-
-    [file setName:@"CIAB_pra"    forVirtualAddress:0xBFD000 reason:NCReason_Automatic];
-    [file setName:@"CIAB_prb"    forVirtualAddress:0xBFD100 reason:NCReason_Automatic];
-    [file setName:@"CIAB_ddra"   forVirtualAddress:0xBFD200 reason:NCReason_Automatic];
-    [file setName:@"CIAB_ddrb"   forVirtualAddress:0xBFD300 reason:NCReason_Automatic];
-    [file setName:@"CIAB_talo"   forVirtualAddress:0xBFD400 reason:NCReason_Automatic];
-    [file setName:@"CIAB_tahi"   forVirtualAddress:0xBFD500 reason:NCReason_Automatic];
-    [file setName:@"CIAB_tblo"   forVirtualAddress:0xBFD600 reason:NCReason_Automatic];
-    [file setName:@"CIAB_tbhi"   forVirtualAddress:0xBFD700 reason:NCReason_Automatic];
-    [file setName:@"CIAB_todlo"  forVirtualAddress:0xBFD800 reason:NCReason_Automatic];
-    [file setName:@"CIAB_todmid" forVirtualAddress:0xBFD900 reason:NCReason_Automatic];
-    [file setName:@"CIAB_todhi"  forVirtualAddress:0xBFDA00 reason:NCReason_Automatic];
-    [file setName:@"CIAB_sdr"    forVirtualAddress:0xBFDC00 reason:NCReason_Automatic];
-    [file setName:@"CIAB_icr"    forVirtualAddress:0xBFDD00 reason:NCReason_Automatic];
-    [file setName:@"CIAB_cra"    forVirtualAddress:0xBFDE00 reason:NCReason_Automatic];
-    [file setName:@"CIAB_crb"    forVirtualAddress:0xBFDF00 reason:NCReason_Automatic];
-
-    [file setName:@"BLTDDAT" forVirtualAddress:0xDFF000 reason:NCReason_Automatic]; [file setInlineComment:@"Blitter dest. early read (dummy address)" atVirtualAddress:0xDFF000 reason:CCReason_Automatic];
-    [file setName:@"DMACONR" forVirtualAddress:0xDFF002 reason:NCReason_Automatic]; [file setInlineComment:@"Dma control (and blitter status) read" atVirtualAddress:0xDFF002 reason:CCReason_Automatic];
-    [file setName:@"VPOSR" forVirtualAddress:0xDFF004 reason:NCReason_Automatic]; [file setInlineComment:@"Read vertical most sig. bits (and frame flop)" atVirtualAddress:0xDFF004 reason:CCReason_Automatic];
-    [file setName:@"VHPOSR" forVirtualAddress:0xDFF006 reason:NCReason_Automatic]; [file setInlineComment:@"Read vert and horiz position of beam" atVirtualAddress:0xDFF006 reason:CCReason_Automatic];
-    [file setName:@"DSKDATR" forVirtualAddress:0xDFF008 reason:NCReason_Automatic]; [file setInlineComment:@"Disk data early read (dummy address)" atVirtualAddress:0xDFF008 reason:CCReason_Automatic];
-    [file setName:@"JOY0DAT" forVirtualAddress:0xDFF00A reason:NCReason_Automatic]; [file setInlineComment:@"Joystick-mouse 0 data (vert, horiz)" atVirtualAddress:0xDFF00A reason:CCReason_Automatic];
-    [file setName:@"JOY1DAT" forVirtualAddress:0xDFF00C reason:NCReason_Automatic]; [file setInlineComment:@"Joystick-mouse 1 data (vert, horiz)" atVirtualAddress:0xDFF00C reason:CCReason_Automatic];
-    [file setName:@"CLXDAT" forVirtualAddress:0xDFF00E reason:NCReason_Automatic]; [file setInlineComment:@"Collision data reg. (read and clear)" atVirtualAddress:0xDFF00E reason:CCReason_Automatic];
-    [file setName:@"ADKCONR" forVirtualAddress:0xDFF010 reason:NCReason_Automatic]; [file setInlineComment:@"Audio,disk control register read" atVirtualAddress:0xDFF010 reason:CCReason_Automatic];
-    [file setName:@"POT0DAT" forVirtualAddress:0xDFF012 reason:NCReason_Automatic]; [file setInlineComment:@"Pot counter data left pair (vert, horiz)" atVirtualAddress:0xDFF012 reason:CCReason_Automatic];
-    [file setName:@"POT1DAT" forVirtualAddress:0xDFF014 reason:NCReason_Automatic]; [file setInlineComment:@"Pot counter data right pair (vert, horiz)" atVirtualAddress:0xDFF014 reason:CCReason_Automatic];
-    [file setName:@"POTINP" forVirtualAddress:0xDFF016 reason:NCReason_Automatic]; [file setInlineComment:@"Pot pin data read" atVirtualAddress:0xDFF016 reason:CCReason_Automatic];
-    [file setName:@"SERDATR" forVirtualAddress:0xDFF018 reason:NCReason_Automatic]; [file setInlineComment:@"Serial port data and status read" atVirtualAddress:0xDFF018 reason:CCReason_Automatic];
-    [file setName:@"DSKBYTR" forVirtualAddress:0xDFF01A reason:NCReason_Automatic]; [file setInlineComment:@"Disk data byte and status read" atVirtualAddress:0xDFF01A reason:CCReason_Automatic];
-    [file setName:@"INTENAR" forVirtualAddress:0xDFF01C reason:NCReason_Automatic]; [file setInlineComment:@"Interrupt enable bits read" atVirtualAddress:0xDFF01C reason:CCReason_Automatic];
-    [file setName:@"INTREQR" forVirtualAddress:0xDFF01E reason:NCReason_Automatic]; [file setInlineComment:@"Interrupt request bits read" atVirtualAddress:0xDFF01E reason:CCReason_Automatic];
-    [file setName:@"DSKPTH" forVirtualAddress:0xDFF020 reason:NCReason_Automatic]; [file setInlineComment:@"Disk pointer (high 5 bits, was 3 bits)" atVirtualAddress:0xDFF020 reason:CCReason_Automatic];
-    [file setName:@"DSKPTL" forVirtualAddress:0xDFF022 reason:NCReason_Automatic]; [file setInlineComment:@"Disk pointer (low 15 bits)" atVirtualAddress:0xDFF022 reason:CCReason_Automatic];
-    [file setName:@"DSKLEN" forVirtualAddress:0xDFF024 reason:NCReason_Automatic]; [file setInlineComment:@"Disk length" atVirtualAddress:0xDFF024 reason:CCReason_Automatic];
-    [file setName:@"DSKDAT" forVirtualAddress:0xDFF026 reason:NCReason_Automatic]; [file setInlineComment:@"Disk DMA data write" atVirtualAddress:0xDFF026 reason:CCReason_Automatic];
-    [file setName:@"REFPTR" forVirtualAddress:0xDFF028 reason:NCReason_Automatic]; [file setInlineComment:@"Refresh pointer" atVirtualAddress:0xDFF028 reason:CCReason_Automatic];
-    [file setName:@"VPOSW" forVirtualAddress:0xDFF02A reason:NCReason_Automatic]; [file setInlineComment:@"Write vert most sig. bits (and frame flop)" atVirtualAddress:0xDFF02A reason:CCReason_Automatic];
-    [file setName:@"VHPOSW" forVirtualAddress:0xDFF02C reason:NCReason_Automatic]; [file setInlineComment:@"Write vert and horiz pos of beam" atVirtualAddress:0xDFF02C reason:CCReason_Automatic];
-    [file setName:@"COPCON" forVirtualAddress:0xDFF02E reason:NCReason_Automatic]; [file setInlineComment:@"Coprocessor control" atVirtualAddress:0xDFF02E reason:CCReason_Automatic];
-    [file setName:@"SERDAT" forVirtualAddress:0xDFF030 reason:NCReason_Automatic]; [file setInlineComment:@"Serial port data and stop bits write" atVirtualAddress:0xDFF030 reason:CCReason_Automatic];
-    [file setName:@"SERPER" forVirtualAddress:0xDFF032 reason:NCReason_Automatic]; [file setInlineComment:@"Serial port period and control" atVirtualAddress:0xDFF032 reason:CCReason_Automatic];
-    [file setName:@"POTGO" forVirtualAddress:0xDFF034 reason:NCReason_Automatic]; [file setInlineComment:@"Pot count start,pot pin drive enable data" atVirtualAddress:0xDFF034 reason:CCReason_Automatic];
-    [file setName:@"JOYTEST" forVirtualAddress:0xDFF036 reason:NCReason_Automatic]; [file setInlineComment:@"Write to all 4 joystick-mouse counters at once" atVirtualAddress:0xDFF036 reason:CCReason_Automatic];
-    [file setName:@"STREQU" forVirtualAddress:0xDFF038 reason:NCReason_Automatic]; [file setInlineComment:@"Strobe for horiz sync with VB and EQU" atVirtualAddress:0xDFF038 reason:CCReason_Automatic];
-    [file setName:@"STRVBL" forVirtualAddress:0xDFF03A reason:NCReason_Automatic]; [file setInlineComment:@"Strobe for horiz sync with VB (vert blank)" atVirtualAddress:0xDFF03A reason:CCReason_Automatic];
-    [file setName:@"STRHOR" forVirtualAddress:0xDFF03C reason:NCReason_Automatic]; [file setInlineComment:@"Strobe for horiz sync" atVirtualAddress:0xDFF03C reason:CCReason_Automatic];
-    [file setName:@"STRLONG" forVirtualAddress:0xDFF03E reason:NCReason_Automatic]; [file setInlineComment:@"Strobe for identification of long horiz line" atVirtualAddress:0xDFF03E reason:CCReason_Automatic];
-    [file setName:@"BLTCON0" forVirtualAddress:0xDFF040 reason:NCReason_Automatic]; [file setInlineComment:@"Blitter control register 0" atVirtualAddress:0xDFF040 reason:CCReason_Automatic];
-    [file setName:@"BLTCON1" forVirtualAddress:0xDFF042 reason:NCReason_Automatic]; [file setInlineComment:@"Blitter control register 1" atVirtualAddress:0xDFF042 reason:CCReason_Automatic];
-    [file setName:@"BLTAFWM" forVirtualAddress:0xDFF044 reason:NCReason_Automatic]; [file setInlineComment:@"Blitter first word mask for source A" atVirtualAddress:0xDFF044 reason:CCReason_Automatic];
-    [file setName:@"BLTALWM" forVirtualAddress:0xDFF046 reason:NCReason_Automatic]; [file setInlineComment:@"Blitter last word mask for source A" atVirtualAddress:0xDFF046 reason:CCReason_Automatic];
-    [file setName:@"BLTCPTH" forVirtualAddress:0xDFF048 reason:NCReason_Automatic]; [file setInlineComment:@"Blitter pointer to source C (high 5 bits, was 3 bits)" atVirtualAddress:0xDFF048 reason:CCReason_Automatic];
-    [file setName:@"BLTCPTL" forVirtualAddress:0xDFF04A reason:NCReason_Automatic]; [file setInlineComment:@"Blitter pointer to source C (low 15 bits)" atVirtualAddress:0xDFF04A reason:CCReason_Automatic];
-    [file setName:@"BLTBPTH" forVirtualAddress:0xDFF04C reason:NCReason_Automatic]; [file setInlineComment:@"Blitter pointer to source B (high 5 bits, was 3 bits)" atVirtualAddress:0xDFF04C reason:CCReason_Automatic];
-    [file setName:@"BLTBPTL" forVirtualAddress:0xDFF04E reason:NCReason_Automatic]; [file setInlineComment:@"Blitter pointer to source B (low 15 bits)" atVirtualAddress:0xDFF04E reason:CCReason_Automatic];
-    [file setName:@"BLTAPTH" forVirtualAddress:0xDFF050 reason:NCReason_Automatic]; [file setInlineComment:@"Blitter pointer to source A (high 5 bits, was 3 bits)" atVirtualAddress:0xDFF050 reason:CCReason_Automatic];
-    [file setName:@"BLTAPTL" forVirtualAddress:0xDFF052 reason:NCReason_Automatic]; [file setInlineComment:@"Blitter pointer to source A (low 15 bits)" atVirtualAddress:0xDFF052 reason:CCReason_Automatic];
-    [file setName:@"BLTDPTH" forVirtualAddress:0xDFF054 reason:NCReason_Automatic]; [file setInlineComment:@"Blitter pointer to dest D (high 5 bits, was 3 bits)" atVirtualAddress:0xDFF054 reason:CCReason_Automatic];
-    [file setName:@"BLTDPTL" forVirtualAddress:0xDFF056 reason:NCReason_Automatic]; [file setInlineComment:@"Blitter pointer to dest D (low 15 bits)" atVirtualAddress:0xDFF056 reason:CCReason_Automatic];
-    [file setName:@"BLTSIZE" forVirtualAddress:0xDFF058 reason:NCReason_Automatic]; [file setInlineComment:@"Blitter start and size (win/width,height)" atVirtualAddress:0xDFF058 reason:CCReason_Automatic];
-    [file setName:@"BLTCON0L" forVirtualAddress:0xDFF05A reason:NCReason_Automatic]; [file setInlineComment:@"Blitter control 0, lower 8 bits (minterms)" atVirtualAddress:0xDFF05A reason:CCReason_Automatic];
-    [file setName:@"BLTSIZV" forVirtualAddress:0xDFF05C reason:NCReason_Automatic]; [file setInlineComment:@"Blitter V size (for 15 bit vertical size)" atVirtualAddress:0xDFF05C reason:CCReason_Automatic];
-    [file setName:@"BLTSIZH" forVirtualAddress:0xDFF05E reason:NCReason_Automatic]; [file setInlineComment:@"Blitter H size and start (for 11 bit H size)" atVirtualAddress:0xDFF05E reason:CCReason_Automatic];
-    [file setName:@"BLTCMOD" forVirtualAddress:0xDFF060 reason:NCReason_Automatic]; [file setInlineComment:@"Blitter modulo for source C" atVirtualAddress:0xDFF060 reason:CCReason_Automatic];
-    [file setName:@"BLTBMOD" forVirtualAddress:0xDFF062 reason:NCReason_Automatic]; [file setInlineComment:@"Blitter modulo for source B" atVirtualAddress:0xDFF062 reason:CCReason_Automatic];
-    [file setName:@"BLTAMOD" forVirtualAddress:0xDFF064 reason:NCReason_Automatic]; [file setInlineComment:@"Blitter modulo for source A" atVirtualAddress:0xDFF064 reason:CCReason_Automatic];
-    [file setName:@"BLTDMOD" forVirtualAddress:0xDFF066 reason:NCReason_Automatic]; [file setInlineComment:@"Blitter modulo for dest D" atVirtualAddress:0xDFF066 reason:CCReason_Automatic];
-    [file setName:@"BLTCDAT" forVirtualAddress:0xDFF070 reason:NCReason_Automatic]; [file setInlineComment:@"Blitter source C data register" atVirtualAddress:0xDFF070 reason:CCReason_Automatic];
-    [file setName:@"BLTBDAT" forVirtualAddress:0xDFF072 reason:NCReason_Automatic]; [file setInlineComment:@"Blitter source B data register" atVirtualAddress:0xDFF072 reason:CCReason_Automatic];
-    [file setName:@"BLTADAT" forVirtualAddress:0xDFF074 reason:NCReason_Automatic]; [file setInlineComment:@"Blitter source A data register" atVirtualAddress:0xDFF074 reason:CCReason_Automatic];
-    [file setName:@"SPRHDAT" forVirtualAddress:0xDFF078 reason:NCReason_Automatic]; [file setInlineComment:@"Ext. logic UHRES sprite pointer and data identifier" atVirtualAddress:0xDFF078 reason:CCReason_Automatic];
-    [file setName:@"BPLHDAT" forVirtualAddress:0xDFF07A reason:NCReason_Automatic]; [file setInlineComment:@"Ext. logic UHRES bit plane identifier" atVirtualAddress:0xDFF07A reason:CCReason_Automatic];
-    [file setName:@"DENISEID" forVirtualAddress:0xDFF07C reason:NCReason_Automatic]; [file setInlineComment:@"Chip revision level for Denise/Lisa (video out chip)" atVirtualAddress:0xDFF07C reason:CCReason_Automatic];
-    [file setName:@"DSKSYNC" forVirtualAddress:0xDFF07E reason:NCReason_Automatic]; [file setInlineComment:@"Disk sync pattern reg for disk read" atVirtualAddress:0xDFF07E reason:CCReason_Automatic];
-    [file setName:@"COP1LCH" forVirtualAddress:0xDFF080 reason:NCReason_Automatic]; [file setInlineComment:@"Coprocessor 1st location (high 5 bits,was 3 bits)" atVirtualAddress:0xDFF080 reason:CCReason_Automatic];
-    [file setName:@"COP1LCL" forVirtualAddress:0xDFF082 reason:NCReason_Automatic]; [file setInlineComment:@"Coprocessor 1st location (low 15 bits)" atVirtualAddress:0xDFF082 reason:CCReason_Automatic];
-    [file setName:@"COP2LCH" forVirtualAddress:0xDFF084 reason:NCReason_Automatic]; [file setInlineComment:@"Coprocessor 2nd location(high 5 bits,was 3 bits)" atVirtualAddress:0xDFF084 reason:CCReason_Automatic];
-    [file setName:@"COP2LCL" forVirtualAddress:0xDFF086 reason:NCReason_Automatic]; [file setInlineComment:@"Coprocessor 2nd location (low 15 bits)" atVirtualAddress:0xDFF086 reason:CCReason_Automatic];
-    [file setName:@"COPJMP1" forVirtualAddress:0xDFF088 reason:NCReason_Automatic]; [file setInlineComment:@"Coprocessor restart at 1st location" atVirtualAddress:0xDFF088 reason:CCReason_Automatic];
-    [file setName:@"COPJMP2" forVirtualAddress:0xDFF08A reason:NCReason_Automatic]; [file setInlineComment:@"Coprocessor restart at 2nd location" atVirtualAddress:0xDFF08A reason:CCReason_Automatic];
-    [file setName:@"COPINS" forVirtualAddress:0xDFF08C reason:NCReason_Automatic]; [file setInlineComment:@"Coprocessor inst fetch identify" atVirtualAddress:0xDFF08C reason:CCReason_Automatic];
-    [file setName:@"DIWSTRT" forVirtualAddress:0xDFF08E reason:NCReason_Automatic]; [file setInlineComment:@"Display window start (upper left vert,horiz pos)" atVirtualAddress:0xDFF08E reason:CCReason_Automatic];
-    [file setName:@"DIWSTOP" forVirtualAddress:0xDFF090 reason:NCReason_Automatic]; [file setInlineComment:@"Display window stop (lower right vert,horiz pos)" atVirtualAddress:0xDFF090 reason:CCReason_Automatic];
-    [file setName:@"DDFSTRT" forVirtualAddress:0xDFF092 reason:NCReason_Automatic]; [file setInlineComment:@"Display bit plane data fetch start,horiz pos" atVirtualAddress:0xDFF092 reason:CCReason_Automatic];
-    [file setName:@"DDFSTOP" forVirtualAddress:0xDFF094 reason:NCReason_Automatic]; [file setInlineComment:@"Display bit plane data fetch stop,horiz pos" atVirtualAddress:0xDFF094 reason:CCReason_Automatic];
-    [file setName:@"DMACON" forVirtualAddress:0xDFF096 reason:NCReason_Automatic]; [file setInlineComment:@"DMA control write (clear or set)" atVirtualAddress:0xDFF096 reason:CCReason_Automatic];
-    [file setName:@"CLXCON" forVirtualAddress:0xDFF098 reason:NCReason_Automatic]; [file setInlineComment:@"Collision control" atVirtualAddress:0xDFF098 reason:CCReason_Automatic];
-    [file setName:@"INTENA" forVirtualAddress:0xDFF09A reason:NCReason_Automatic]; [file setInlineComment:@"Interrupt enable bits (clear or set bits)" atVirtualAddress:0xDFF09A reason:CCReason_Automatic];
-    [file setName:@"INTREQ" forVirtualAddress:0xDFF09C reason:NCReason_Automatic]; [file setInlineComment:@"Interrupt request bits (clear or set bits)" atVirtualAddress:0xDFF09C reason:CCReason_Automatic];
-    [file setName:@"ADKCON" forVirtualAddress:0xDFF09E reason:NCReason_Automatic]; [file setInlineComment:@"Audio,disk,UART control" atVirtualAddress:0xDFF09E reason:CCReason_Automatic];
-    [file setName:@"AUD0LCH" forVirtualAddress:0xDFF0A0 reason:NCReason_Automatic]; [file setInlineComment:@"Audio channel 0 location (high 5 bits was 3 bits)" atVirtualAddress:0xDFF0A0 reason:CCReason_Automatic];
-    [file setName:@"AUD0LCL" forVirtualAddress:0xDFF0A2 reason:NCReason_Automatic]; [file setInlineComment:@"Audio channel 0 location (low 15 bits)" atVirtualAddress:0xDFF0A2 reason:CCReason_Automatic];
-    [file setName:@"AUD0LEN" forVirtualAddress:0xDFF0A4 reason:NCReason_Automatic]; [file setInlineComment:@"Audio channel 0 length" atVirtualAddress:0xDFF0A4 reason:CCReason_Automatic];
-    [file setName:@"AUD0PER" forVirtualAddress:0xDFF0A6 reason:NCReason_Automatic]; [file setInlineComment:@"Audio channel 0 period" atVirtualAddress:0xDFF0A6 reason:CCReason_Automatic];
-    [file setName:@"AUD0VOL" forVirtualAddress:0xDFF0A8 reason:NCReason_Automatic]; [file setInlineComment:@"Audio channel 0 volume" atVirtualAddress:0xDFF0A8 reason:CCReason_Automatic];
-    [file setName:@"AUD0DAT" forVirtualAddress:0xDFF0AA reason:NCReason_Automatic]; [file setInlineComment:@"Audio channel 0 data" atVirtualAddress:0xDFF0AA reason:CCReason_Automatic];
-    [file setName:@"AUD1LCH" forVirtualAddress:0xDFF0B0 reason:NCReason_Automatic]; [file setInlineComment:@"Audio channel 1 location (high 5 bits was 3 bits)" atVirtualAddress:0xDFF0B0 reason:CCReason_Automatic];
-    [file setName:@"AUD1LCL" forVirtualAddress:0xDFF0B2 reason:NCReason_Automatic]; [file setInlineComment:@"Audio channel 1 location (low 15 bits)" atVirtualAddress:0xDFF0B2 reason:CCReason_Automatic];
-    [file setName:@"AUD1LEN" forVirtualAddress:0xDFF0B4 reason:NCReason_Automatic]; [file setInlineComment:@"Audio channel 1 length" atVirtualAddress:0xDFF0B4 reason:CCReason_Automatic];
-    [file setName:@"AUD1PER" forVirtualAddress:0xDFF0B6 reason:NCReason_Automatic]; [file setInlineComment:@"Audio channel 1 period" atVirtualAddress:0xDFF0B6 reason:CCReason_Automatic];
-    [file setName:@"AUD1VOL" forVirtualAddress:0xDFF0B8 reason:NCReason_Automatic]; [file setInlineComment:@"Audio channel 1 volume" atVirtualAddress:0xDFF0B8 reason:CCReason_Automatic];
-    [file setName:@"AUD1DAT" forVirtualAddress:0xDFF0BA reason:NCReason_Automatic]; [file setInlineComment:@"Audio channel 1 data" atVirtualAddress:0xDFF0BA reason:CCReason_Automatic];
-    [file setName:@"AUD2LCH" forVirtualAddress:0xDFF0C0 reason:NCReason_Automatic]; [file setInlineComment:@"Audio channel 2 location (high 5 bits was 3 bits)" atVirtualAddress:0xDFF0C0 reason:CCReason_Automatic];
-    [file setName:@"AUD2LCL" forVirtualAddress:0xDFF0C2 reason:NCReason_Automatic]; [file setInlineComment:@"Audio channel 2 location (low 15 bits)" atVirtualAddress:0xDFF0C2 reason:CCReason_Automatic];
-    [file setName:@"AUD2LEN" forVirtualAddress:0xDFF0C4 reason:NCReason_Automatic]; [file setInlineComment:@"Audio channel 2 length" atVirtualAddress:0xDFF0C4 reason:CCReason_Automatic];
-    [file setName:@"AUD2PER" forVirtualAddress:0xDFF0C6 reason:NCReason_Automatic]; [file setInlineComment:@"Audio channel 2 period" atVirtualAddress:0xDFF0C6 reason:CCReason_Automatic];
-    [file setName:@"AUD2VOL" forVirtualAddress:0xDFF0C8 reason:NCReason_Automatic]; [file setInlineComment:@"Audio channel 2 volume" atVirtualAddress:0xDFF0C8 reason:CCReason_Automatic];
-    [file setName:@"AUD2DAT" forVirtualAddress:0xDFF0CA reason:NCReason_Automatic]; [file setInlineComment:@"Audio channel 2 data" atVirtualAddress:0xDFF0CA reason:CCReason_Automatic];
-    [file setName:@"AUD3LCH" forVirtualAddress:0xDFF0D0 reason:NCReason_Automatic]; [file setInlineComment:@"Audio channel 3 location (high 5 bits was 3 bits)" atVirtualAddress:0xDFF0D0 reason:CCReason_Automatic];
-    [file setName:@"AUD3LCL" forVirtualAddress:0xDFF0D2 reason:NCReason_Automatic]; [file setInlineComment:@"Audio channel 3 location (low 15 bits)" atVirtualAddress:0xDFF0D2 reason:CCReason_Automatic];
-    [file setName:@"AUD3LEN" forVirtualAddress:0xDFF0D4 reason:NCReason_Automatic]; [file setInlineComment:@"Audio channel 3 length" atVirtualAddress:0xDFF0D4 reason:CCReason_Automatic];
-    [file setName:@"AUD3PER" forVirtualAddress:0xDFF0D6 reason:NCReason_Automatic]; [file setInlineComment:@"Audio channel 3 period" atVirtualAddress:0xDFF0D6 reason:CCReason_Automatic];
-    [file setName:@"AUD3VOL" forVirtualAddress:0xDFF0D8 reason:NCReason_Automatic]; [file setInlineComment:@"Audio channel 3 volume" atVirtualAddress:0xDFF0D8 reason:CCReason_Automatic];
-    [file setName:@"AUD3DAT" forVirtualAddress:0xDFF0DA reason:NCReason_Automatic]; [file setInlineComment:@"Audio channel 3 data" atVirtualAddress:0xDFF0DA reason:CCReason_Automatic];
-    [file setName:@"BPL1PTH" forVirtualAddress:0xDFF0E0 reason:NCReason_Automatic]; [file setInlineComment:@"Bitplane pointer 1 (high 5 bits was 3 bits)" atVirtualAddress:0xDFF0E0 reason:CCReason_Automatic];
-    [file setName:@"BPL1PTL" forVirtualAddress:0xDFF0E2 reason:NCReason_Automatic]; [file setInlineComment:@"Bitplane pointer 1 (low 15 bits)" atVirtualAddress:0xDFF0E2 reason:CCReason_Automatic];
-    [file setName:@"BPL2PTH" forVirtualAddress:0xDFF0E4 reason:NCReason_Automatic]; [file setInlineComment:@"Bitplane pointer 2 (high 5 bits was 3 bits)" atVirtualAddress:0xDFF0E4 reason:CCReason_Automatic];
-    [file setName:@"BPL2PTL" forVirtualAddress:0xDFF0E6 reason:NCReason_Automatic]; [file setInlineComment:@"Bitplane pointer 2 (low 15 bits)" atVirtualAddress:0xDFF0E6 reason:CCReason_Automatic];
-    [file setName:@"BPL3PTH" forVirtualAddress:0xDFF0E8 reason:NCReason_Automatic]; [file setInlineComment:@"Bitplane pointer 3 (high 5 bits was 3 bits)" atVirtualAddress:0xDFF0E8 reason:CCReason_Automatic];
-    [file setName:@"BPL3PTL" forVirtualAddress:0xDFF0EA reason:NCReason_Automatic]; [file setInlineComment:@"Bitplane pointer 3 (low 15 bits)" atVirtualAddress:0xDFF0EA reason:CCReason_Automatic];
-    [file setName:@"BPL4PTH" forVirtualAddress:0xDFF0EC reason:NCReason_Automatic]; [file setInlineComment:@"Bitplane pointer 4 (high 5 bits was 3 bits)" atVirtualAddress:0xDFF0EC reason:CCReason_Automatic];
-    [file setName:@"BPL4PTL" forVirtualAddress:0xDFF0EE reason:NCReason_Automatic]; [file setInlineComment:@"Bitplane pointer 4 (low 15 bits)" atVirtualAddress:0xDFF0EE reason:CCReason_Automatic];
-    [file setName:@"BPL5PTH" forVirtualAddress:0xDFF0F0 reason:NCReason_Automatic]; [file setInlineComment:@"Bitplane pointer 5 (high 5 bits was 3 bits)" atVirtualAddress:0xDFF0F0 reason:CCReason_Automatic];
-    [file setName:@"BPL5PTL" forVirtualAddress:0xDFF0F2 reason:NCReason_Automatic]; [file setInlineComment:@"Bitplane pointer 5 (low 15 bits)" atVirtualAddress:0xDFF0F2 reason:CCReason_Automatic];
-    [file setName:@"BPL6PTH" forVirtualAddress:0xDFF0F4 reason:NCReason_Automatic]; [file setInlineComment:@"Bitplane pointer 6 (high 5 bits was 3 bits)" atVirtualAddress:0xDFF0F4 reason:CCReason_Automatic];
-    [file setName:@"BPL6PTL" forVirtualAddress:0xDFF0F6 reason:NCReason_Automatic]; [file setInlineComment:@"Bitplane pointer 6 (low 15 bits)" atVirtualAddress:0xDFF0F6 reason:CCReason_Automatic];
-    [file setName:@"BPL7PTH" forVirtualAddress:0xDFF0F8 reason:NCReason_Automatic]; [file setInlineComment:@"pointer 7 (high 5 bits was 3 bits)" atVirtualAddress:0xDFF0F8 reason:CCReason_Automatic];
-    [file setName:@"BPL7PTL" forVirtualAddress:0xDFF0FA reason:NCReason_Automatic]; [file setInlineComment:@"pointer 7 (low 15 bits)" atVirtualAddress:0xDFF0FA reason:CCReason_Automatic];
-    [file setName:@"BPL8PTH" forVirtualAddress:0xDFF0FC reason:NCReason_Automatic]; [file setInlineComment:@"pointer 8 (high 5 bits was 3 bits)" atVirtualAddress:0xDFF0FC reason:CCReason_Automatic];
-    [file setName:@"BPL8PTL" forVirtualAddress:0xDFF0FE reason:NCReason_Automatic]; [file setInlineComment:@"pointer 8 (low 15 bits)" atVirtualAddress:0xDFF0FE reason:CCReason_Automatic];
-    [file setName:@"BPLCON0" forVirtualAddress:0xDFF100 reason:NCReason_Automatic]; [file setInlineComment:@"Bitplane control (miscellaneous control bits)" atVirtualAddress:0xDFF100 reason:CCReason_Automatic];
-    [file setName:@"BPLCON1" forVirtualAddress:0xDFF102 reason:NCReason_Automatic]; [file setInlineComment:@"Bitplane control (scroll value)" atVirtualAddress:0xDFF102 reason:CCReason_Automatic];
-    [file setName:@"BPLCON2" forVirtualAddress:0xDFF104 reason:NCReason_Automatic]; [file setInlineComment:@"Bitplane control (video priority control)" atVirtualAddress:0xDFF104 reason:CCReason_Automatic];
-    [file setName:@"BPLCON3" forVirtualAddress:0xDFF106 reason:NCReason_Automatic]; [file setInlineComment:@"Bitplane control (enhanced features)" atVirtualAddress:0xDFF106 reason:CCReason_Automatic];
-    [file setName:@"BPL1MOD" forVirtualAddress:0xDFF108 reason:NCReason_Automatic]; [file setInlineComment:@"Bitplane modulo (odd planes)" atVirtualAddress:0xDFF108 reason:CCReason_Automatic];
-    [file setName:@"BPL2MOD" forVirtualAddress:0xDFF10A reason:NCReason_Automatic]; [file setInlineComment:@"Bitplane modulo (even planes)" atVirtualAddress:0xDFF10A reason:CCReason_Automatic];
-    [file setName:@"BPLCON4" forVirtualAddress:0xDFF10C reason:NCReason_Automatic]; [file setInlineComment:@"control (bitplane and sprite-masks)" atVirtualAddress:0xDFF10C reason:CCReason_Automatic];
-    [file setName:@"CLXCON2" forVirtualAddress:0xDFF10E reason:NCReason_Automatic]; [file setInlineComment:@"collision control" atVirtualAddress:0xDFF10E reason:CCReason_Automatic];
-    [file setName:@"BPL1DAT" forVirtualAddress:0xDFF110 reason:NCReason_Automatic]; [file setInlineComment:@"Bitplane 1 data (parallel to serial convert)" atVirtualAddress:0xDFF110 reason:CCReason_Automatic];
-    [file setName:@"BPL2DAT" forVirtualAddress:0xDFF112 reason:NCReason_Automatic]; [file setInlineComment:@"Bitplane 2 data (parallel to serial convert)" atVirtualAddress:0xDFF112 reason:CCReason_Automatic];
-    [file setName:@"BPL3DAT" forVirtualAddress:0xDFF114 reason:NCReason_Automatic]; [file setInlineComment:@"Bitplane 3 data (parallel to serial convert)" atVirtualAddress:0xDFF114 reason:CCReason_Automatic];
-    [file setName:@"BPL4DAT" forVirtualAddress:0xDFF116 reason:NCReason_Automatic]; [file setInlineComment:@"Bitplane 4 data (parallel to serial convert)" atVirtualAddress:0xDFF116 reason:CCReason_Automatic];
-    [file setName:@"BPL5DAT" forVirtualAddress:0xDFF118 reason:NCReason_Automatic]; [file setInlineComment:@"Bitplane 5 data (parallel to serial convert)" atVirtualAddress:0xDFF118 reason:CCReason_Automatic];
-    [file setName:@"BPL6DAT" forVirtualAddress:0xDFF11A reason:NCReason_Automatic]; [file setInlineComment:@"Bitplane 6 data (parallel to serial convert)" atVirtualAddress:0xDFF11A reason:CCReason_Automatic];
-    [file setName:@"BPL7DAT" forVirtualAddress:0xDFF11C reason:NCReason_Automatic]; [file setInlineComment:@"7 data (parallel to serial convert)" atVirtualAddress:0xDFF11C reason:CCReason_Automatic];
-    [file setName:@"BPL8DAT" forVirtualAddress:0xDFF11E reason:NCReason_Automatic]; [file setInlineComment:@"8 data (parallel to serial convert)" atVirtualAddress:0xDFF11E reason:CCReason_Automatic];
-    [file setName:@"SPR0PTH" forVirtualAddress:0xDFF120 reason:NCReason_Automatic]; [file setInlineComment:@"Sprite 0 pointer (high 5 bits was 3 bits)" atVirtualAddress:0xDFF120 reason:CCReason_Automatic];
-    [file setName:@"SPR0PTL" forVirtualAddress:0xDFF122 reason:NCReason_Automatic]; [file setInlineComment:@"Sprite 0 pointer (low 15 bits)" atVirtualAddress:0xDFF122 reason:CCReason_Automatic];
-    [file setName:@"SPR1PTH" forVirtualAddress:0xDFF124 reason:NCReason_Automatic]; [file setInlineComment:@"Sprite 1 pointer (high 5 bits was 3 bits)" atVirtualAddress:0xDFF124 reason:CCReason_Automatic];
-    [file setName:@"SPR1PTL" forVirtualAddress:0xDFF126 reason:NCReason_Automatic]; [file setInlineComment:@"Sprite 1 pointer (low 15 bits)" atVirtualAddress:0xDFF126 reason:CCReason_Automatic];
-    [file setName:@"SPR2PTH" forVirtualAddress:0xDFF128 reason:NCReason_Automatic]; [file setInlineComment:@"Sprite 2 pointer (high 5 bits was 3 bits)" atVirtualAddress:0xDFF128 reason:CCReason_Automatic];
-    [file setName:@"SPR2PTL" forVirtualAddress:0xDFF12A reason:NCReason_Automatic]; [file setInlineComment:@"Sprite 2 pointer (low 15 bits)" atVirtualAddress:0xDFF12A reason:CCReason_Automatic];
-    [file setName:@"SPR3PTH" forVirtualAddress:0xDFF12C reason:NCReason_Automatic]; [file setInlineComment:@"Sprite 3 pointer (high 5 bits was 3 bits)" atVirtualAddress:0xDFF12C reason:CCReason_Automatic];
-    [file setName:@"SPR3PTL" forVirtualAddress:0xDFF12E reason:NCReason_Automatic]; [file setInlineComment:@"Sprite 3 pointer (low 15 bits)" atVirtualAddress:0xDFF12E reason:CCReason_Automatic];
-    [file setName:@"SPR4PTH" forVirtualAddress:0xDFF130 reason:NCReason_Automatic]; [file setInlineComment:@"Sprite 4 pointer (high 5 bits was 3 bits)" atVirtualAddress:0xDFF130 reason:CCReason_Automatic];
-    [file setName:@"SPR4PTL" forVirtualAddress:0xDFF132 reason:NCReason_Automatic]; [file setInlineComment:@"Sprite 4 pointer (low 15 bits)" atVirtualAddress:0xDFF132 reason:CCReason_Automatic];
-    [file setName:@"SPR5PTH" forVirtualAddress:0xDFF134 reason:NCReason_Automatic]; [file setInlineComment:@"Sprite 5 pointer (high 5 bits was 3 bits)" atVirtualAddress:0xDFF134 reason:CCReason_Automatic];
-    [file setName:@"SPR5PTL" forVirtualAddress:0xDFF136 reason:NCReason_Automatic]; [file setInlineComment:@"Sprite 5 pointer (low 15 bits)" atVirtualAddress:0xDFF136 reason:CCReason_Automatic];
-    [file setName:@"SPR6PTH" forVirtualAddress:0xDFF138 reason:NCReason_Automatic]; [file setInlineComment:@"Sprite 6 pointer (high 5 bits was 3 bits)" atVirtualAddress:0xDFF138 reason:CCReason_Automatic];
-    [file setName:@"SPR6PTL" forVirtualAddress:0xDFF13A reason:NCReason_Automatic]; [file setInlineComment:@"Sprite 6 pointer (low 15 bits)" atVirtualAddress:0xDFF13A reason:CCReason_Automatic];
-    [file setName:@"SPR7PTH" forVirtualAddress:0xDFF13C reason:NCReason_Automatic]; [file setInlineComment:@"Sprite 7 pointer (high 5 bits was 3 bits)" atVirtualAddress:0xDFF13C reason:CCReason_Automatic];
-    [file setName:@"SPR7PTL" forVirtualAddress:0xDFF13E reason:NCReason_Automatic]; [file setInlineComment:@"Sprite 7 pointer (low 15 bits)" atVirtualAddress:0xDFF13E reason:CCReason_Automatic];
-    [file setName:@"SPR0POS" forVirtualAddress:0xDFF140 reason:NCReason_Automatic]; [file setInlineComment:@"Sprite 0 vert,horiz start pos data" atVirtualAddress:0xDFF140 reason:CCReason_Automatic];
-    [file setName:@"SPR0CTL" forVirtualAddress:0xDFF142 reason:NCReason_Automatic]; [file setInlineComment:@"Sprite 0 position and control data" atVirtualAddress:0xDFF142 reason:CCReason_Automatic];
-    [file setName:@"SPR0DATA" forVirtualAddress:0xDFF144 reason:NCReason_Automatic]; [file setInlineComment:@"Sprite 0 image data register A" atVirtualAddress:0xDFF144 reason:CCReason_Automatic];
-    [file setName:@"SPR0DATB" forVirtualAddress:0xDFF146 reason:NCReason_Automatic]; [file setInlineComment:@"Sprite 0 image data register B" atVirtualAddress:0xDFF146 reason:CCReason_Automatic];
-    [file setName:@"SPR1POS" forVirtualAddress:0xDFF148 reason:NCReason_Automatic]; [file setInlineComment:@"Sprite 1 vert,horiz start pos data" atVirtualAddress:0xDFF148 reason:CCReason_Automatic];
-    [file setName:@"SPR1CTL" forVirtualAddress:0xDFF14A reason:NCReason_Automatic]; [file setInlineComment:@"Sprite 1 position and control data" atVirtualAddress:0xDFF14A reason:CCReason_Automatic];
-    [file setName:@"SPR1DATA" forVirtualAddress:0xDFF14C reason:NCReason_Automatic]; [file setInlineComment:@"Sprite 1 image data register A" atVirtualAddress:0xDFF14C reason:CCReason_Automatic];
-    [file setName:@"SPR1DATB" forVirtualAddress:0xDFF14E reason:NCReason_Automatic]; [file setInlineComment:@"Sprite 1 image data register B" atVirtualAddress:0xDFF14E reason:CCReason_Automatic];
-    [file setName:@"SPR2POS" forVirtualAddress:0xDFF150 reason:NCReason_Automatic]; [file setInlineComment:@"Sprite 2 vert,horiz start pos data" atVirtualAddress:0xDFF150 reason:CCReason_Automatic];
-    [file setName:@"SPR2CTL" forVirtualAddress:0xDFF152 reason:NCReason_Automatic]; [file setInlineComment:@"Sprite 2 position and control data" atVirtualAddress:0xDFF152 reason:CCReason_Automatic];
-    [file setName:@"SPR2DATA" forVirtualAddress:0xDFF154 reason:NCReason_Automatic]; [file setInlineComment:@"Sprite 2 image data register A" atVirtualAddress:0xDFF154 reason:CCReason_Automatic];
-    [file setName:@"SPR2DATB" forVirtualAddress:0xDFF156 reason:NCReason_Automatic]; [file setInlineComment:@"Sprite 2 image data register B" atVirtualAddress:0xDFF156 reason:CCReason_Automatic];
-    [file setName:@"SPR3POS" forVirtualAddress:0xDFF158 reason:NCReason_Automatic]; [file setInlineComment:@"Sprite 3 vert,horiz start pos data" atVirtualAddress:0xDFF158 reason:CCReason_Automatic];
-    [file setName:@"SPR3CTL" forVirtualAddress:0xDFF15A reason:NCReason_Automatic]; [file setInlineComment:@"Sprite 3 position and control data" atVirtualAddress:0xDFF15A reason:CCReason_Automatic];
-    [file setName:@"SPR3DATA" forVirtualAddress:0xDFF15C reason:NCReason_Automatic]; [file setInlineComment:@"Sprite 3 image data register A" atVirtualAddress:0xDFF15C reason:CCReason_Automatic];
-    [file setName:@"SPR3DATB" forVirtualAddress:0xDFF15E reason:NCReason_Automatic]; [file setInlineComment:@"Sprite 3 image data register B" atVirtualAddress:0xDFF15E reason:CCReason_Automatic];
-    [file setName:@"SPR4POS" forVirtualAddress:0xDFF160 reason:NCReason_Automatic]; [file setInlineComment:@"Sprite 4 vert,horiz start pos data" atVirtualAddress:0xDFF160 reason:CCReason_Automatic];
-    [file setName:@"SPR4CTL" forVirtualAddress:0xDFF162 reason:NCReason_Automatic]; [file setInlineComment:@"Sprite 4 position and control data" atVirtualAddress:0xDFF162 reason:CCReason_Automatic];
-    [file setName:@"SPR4DATA" forVirtualAddress:0xDFF164 reason:NCReason_Automatic]; [file setInlineComment:@"Sprite 4 image data register A" atVirtualAddress:0xDFF164 reason:CCReason_Automatic];
-    [file setName:@"SPR4DATB" forVirtualAddress:0xDFF166 reason:NCReason_Automatic]; [file setInlineComment:@"Sprite 4 image data register B" atVirtualAddress:0xDFF166 reason:CCReason_Automatic];
-    [file setName:@"SPR5POS" forVirtualAddress:0xDFF168 reason:NCReason_Automatic]; [file setInlineComment:@"Sprite 5 vert,horiz start pos data" atVirtualAddress:0xDFF168 reason:CCReason_Automatic];
-    [file setName:@"SPR5CTL" forVirtualAddress:0xDFF16A reason:NCReason_Automatic]; [file setInlineComment:@"Sprite 5 position and control data" atVirtualAddress:0xDFF16A reason:CCReason_Automatic];
-    [file setName:@"SPR5DATA" forVirtualAddress:0xDFF16C reason:NCReason_Automatic]; [file setInlineComment:@"Sprite 5 image data register A" atVirtualAddress:0xDFF16C reason:CCReason_Automatic];
-    [file setName:@"SPR5DATB" forVirtualAddress:0xDFF16E reason:NCReason_Automatic]; [file setInlineComment:@"Sprite 5 image data register B" atVirtualAddress:0xDFF16E reason:CCReason_Automatic];
-    [file setName:@"SPR6POS" forVirtualAddress:0xDFF170 reason:NCReason_Automatic]; [file setInlineComment:@"Sprite 6 vert,horiz start pos data" atVirtualAddress:0xDFF170 reason:CCReason_Automatic];
-    [file setName:@"SPR6CTL" forVirtualAddress:0xDFF172 reason:NCReason_Automatic]; [file setInlineComment:@"Sprite 6 position and control data" atVirtualAddress:0xDFF172 reason:CCReason_Automatic];
-    [file setName:@"SPR6DATA" forVirtualAddress:0xDFF174 reason:NCReason_Automatic]; [file setInlineComment:@"Sprite 6 image data register A" atVirtualAddress:0xDFF174 reason:CCReason_Automatic];
-    [file setName:@"SPR6DATB" forVirtualAddress:0xDFF176 reason:NCReason_Automatic]; [file setInlineComment:@"Sprite 6 image data register B" atVirtualAddress:0xDFF176 reason:CCReason_Automatic];
-    [file setName:@"SPR7POS" forVirtualAddress:0xDFF178 reason:NCReason_Automatic]; [file setInlineComment:@"Sprite 7 vert,horiz start pos data" atVirtualAddress:0xDFF178 reason:CCReason_Automatic];
-    [file setName:@"SPR7CTL" forVirtualAddress:0xDFF17A reason:NCReason_Automatic]; [file setInlineComment:@"Sprite 7 position and control data" atVirtualAddress:0xDFF17A reason:CCReason_Automatic];
-    [file setName:@"SPR7DATA" forVirtualAddress:0xDFF17C reason:NCReason_Automatic]; [file setInlineComment:@"Sprite 7 image data register A" atVirtualAddress:0xDFF17C reason:CCReason_Automatic];
-    [file setName:@"SPR7DATB" forVirtualAddress:0xDFF17E reason:NCReason_Automatic]; [file setInlineComment:@"Sprite 7 image data register B" atVirtualAddress:0xDFF17E reason:CCReason_Automatic];
-    [file setName:@"COLOR00" forVirtualAddress:0xDFF180 reason:NCReason_Automatic]; [file setInlineComment:@"Color table 0" atVirtualAddress:0xDFF180 reason:CCReason_Automatic];
-    [file setName:@"COLOR01" forVirtualAddress:0xDFF182 reason:NCReason_Automatic]; [file setInlineComment:@"Color table 1" atVirtualAddress:0xDFF182 reason:CCReason_Automatic];
-    [file setName:@"COLOR02" forVirtualAddress:0xDFF184 reason:NCReason_Automatic]; [file setInlineComment:@"Color table 2" atVirtualAddress:0xDFF184 reason:CCReason_Automatic];
-    [file setName:@"COLOR03" forVirtualAddress:0xDFF186 reason:NCReason_Automatic]; [file setInlineComment:@"Color table 3" atVirtualAddress:0xDFF186 reason:CCReason_Automatic];
-    [file setName:@"COLOR04" forVirtualAddress:0xDFF188 reason:NCReason_Automatic]; [file setInlineComment:@"Color table 4" atVirtualAddress:0xDFF188 reason:CCReason_Automatic];
-    [file setName:@"COLOR05" forVirtualAddress:0xDFF18A reason:NCReason_Automatic]; [file setInlineComment:@"Color table 5" atVirtualAddress:0xDFF18A reason:CCReason_Automatic];
-    [file setName:@"COLOR06" forVirtualAddress:0xDFF18C reason:NCReason_Automatic]; [file setInlineComment:@"Color table 6" atVirtualAddress:0xDFF18C reason:CCReason_Automatic];
-    [file setName:@"COLOR07" forVirtualAddress:0xDFF18E reason:NCReason_Automatic]; [file setInlineComment:@"Color table 7" atVirtualAddress:0xDFF18E reason:CCReason_Automatic];
-    [file setName:@"COLOR08" forVirtualAddress:0xDFF190 reason:NCReason_Automatic]; [file setInlineComment:@"Color table 8" atVirtualAddress:0xDFF190 reason:CCReason_Automatic];
-    [file setName:@"COLOR09" forVirtualAddress:0xDFF192 reason:NCReason_Automatic]; [file setInlineComment:@"Color table 9" atVirtualAddress:0xDFF192 reason:CCReason_Automatic];
-    [file setName:@"COLOR10" forVirtualAddress:0xDFF194 reason:NCReason_Automatic]; [file setInlineComment:@"Color table 10" atVirtualAddress:0xDFF194 reason:CCReason_Automatic];
-    [file setName:@"COLOR11" forVirtualAddress:0xDFF196 reason:NCReason_Automatic]; [file setInlineComment:@"Color table 11" atVirtualAddress:0xDFF196 reason:CCReason_Automatic];
-    [file setName:@"COLOR12" forVirtualAddress:0xDFF198 reason:NCReason_Automatic]; [file setInlineComment:@"Color table 12" atVirtualAddress:0xDFF198 reason:CCReason_Automatic];
-    [file setName:@"COLOR13" forVirtualAddress:0xDFF19A reason:NCReason_Automatic]; [file setInlineComment:@"Color table 13" atVirtualAddress:0xDFF19A reason:CCReason_Automatic];
-    [file setName:@"COLOR14" forVirtualAddress:0xDFF19C reason:NCReason_Automatic]; [file setInlineComment:@"Color table 14" atVirtualAddress:0xDFF19C reason:CCReason_Automatic];
-    [file setName:@"COLOR15" forVirtualAddress:0xDFF19E reason:NCReason_Automatic]; [file setInlineComment:@"Color table 15" atVirtualAddress:0xDFF19E reason:CCReason_Automatic];
-    [file setName:@"COLOR16" forVirtualAddress:0xDFF1A0 reason:NCReason_Automatic]; [file setInlineComment:@"Color table 16" atVirtualAddress:0xDFF1A0 reason:CCReason_Automatic];
-    [file setName:@"COLOR17" forVirtualAddress:0xDFF1A2 reason:NCReason_Automatic]; [file setInlineComment:@"Color table 17" atVirtualAddress:0xDFF1A2 reason:CCReason_Automatic];
-    [file setName:@"COLOR18" forVirtualAddress:0xDFF1A4 reason:NCReason_Automatic]; [file setInlineComment:@"Color table 18" atVirtualAddress:0xDFF1A4 reason:CCReason_Automatic];
-    [file setName:@"COLOR19" forVirtualAddress:0xDFF1A6 reason:NCReason_Automatic]; [file setInlineComment:@"Color table 19" atVirtualAddress:0xDFF1A6 reason:CCReason_Automatic];
-    [file setName:@"COLOR20" forVirtualAddress:0xDFF1A8 reason:NCReason_Automatic]; [file setInlineComment:@"Color table 20" atVirtualAddress:0xDFF1A8 reason:CCReason_Automatic];
-    [file setName:@"COLOR21" forVirtualAddress:0xDFF1AA reason:NCReason_Automatic]; [file setInlineComment:@"Color table 21" atVirtualAddress:0xDFF1AA reason:CCReason_Automatic];
-    [file setName:@"COLOR22" forVirtualAddress:0xDFF1AC reason:NCReason_Automatic]; [file setInlineComment:@"Color table 22" atVirtualAddress:0xDFF1AC reason:CCReason_Automatic];
-    [file setName:@"COLOR23" forVirtualAddress:0xDFF1AE reason:NCReason_Automatic]; [file setInlineComment:@"Color table 23" atVirtualAddress:0xDFF1AE reason:CCReason_Automatic];
-    [file setName:@"COLOR24" forVirtualAddress:0xDFF1B0 reason:NCReason_Automatic]; [file setInlineComment:@"Color table 24" atVirtualAddress:0xDFF1B0 reason:CCReason_Automatic];
-    [file setName:@"COLOR25" forVirtualAddress:0xDFF1B2 reason:NCReason_Automatic]; [file setInlineComment:@"Color table 25" atVirtualAddress:0xDFF1B2 reason:CCReason_Automatic];
-    [file setName:@"COLOR26" forVirtualAddress:0xDFF1B4 reason:NCReason_Automatic]; [file setInlineComment:@"Color table 26" atVirtualAddress:0xDFF1B4 reason:CCReason_Automatic];
-    [file setName:@"COLOR27" forVirtualAddress:0xDFF1B6 reason:NCReason_Automatic]; [file setInlineComment:@"Color table 27" atVirtualAddress:0xDFF1B6 reason:CCReason_Automatic];
-    [file setName:@"COLOR28" forVirtualAddress:0xDFF1B8 reason:NCReason_Automatic]; [file setInlineComment:@"Color table 28" atVirtualAddress:0xDFF1B8 reason:CCReason_Automatic];
-    [file setName:@"COLOR29" forVirtualAddress:0xDFF1BA reason:NCReason_Automatic]; [file setInlineComment:@"Color table 29" atVirtualAddress:0xDFF1BA reason:CCReason_Automatic];
-    [file setName:@"COLOR30" forVirtualAddress:0xDFF1BC reason:NCReason_Automatic]; [file setInlineComment:@"Color table 30" atVirtualAddress:0xDFF1BC reason:CCReason_Automatic];
-    [file setName:@"COLOR31" forVirtualAddress:0xDFF1BE reason:NCReason_Automatic]; [file setInlineComment:@"Color table 31" atVirtualAddress:0xDFF1BE reason:CCReason_Automatic];
-    [file setName:@"HTOTAL" forVirtualAddress:0xDFF1C0 reason:NCReason_Automatic]; [file setInlineComment:@"Highest number count, horiz line (VARBEAMEN=1)" atVirtualAddress:0xDFF1C0 reason:CCReason_Automatic];
-    [file setName:@"HSSTOP" forVirtualAddress:0xDFF1C2 reason:NCReason_Automatic]; [file setInlineComment:@"Horizontal line position for HSYNC stop" atVirtualAddress:0xDFF1C2 reason:CCReason_Automatic];
-    [file setName:@"HBSTRT" forVirtualAddress:0xDFF1C4 reason:NCReason_Automatic]; [file setInlineComment:@"Horizontal line position for HBLANK start" atVirtualAddress:0xDFF1C4 reason:CCReason_Automatic];
-    [file setName:@"HBSTOP" forVirtualAddress:0xDFF1C6 reason:NCReason_Automatic]; [file setInlineComment:@"Horizontal line position for HBLANK stop" atVirtualAddress:0xDFF1C6 reason:CCReason_Automatic];
-    [file setName:@"VTOTAL" forVirtualAddress:0xDFF1C8 reason:NCReason_Automatic]; [file setInlineComment:@"Highest numbered vertical line (VARBEAMEN=1)" atVirtualAddress:0xDFF1C8 reason:CCReason_Automatic];
-    [file setName:@"VSSTOP" forVirtualAddress:0xDFF1CA reason:NCReason_Automatic]; [file setInlineComment:@"Vertical line position for VSYNC stop" atVirtualAddress:0xDFF1CA reason:CCReason_Automatic];
-    [file setName:@"VBSTRT" forVirtualAddress:0xDFF1CC reason:NCReason_Automatic]; [file setInlineComment:@"Vertical line for VBLANK start" atVirtualAddress:0xDFF1CC reason:CCReason_Automatic];
-    [file setName:@"VBSTOP" forVirtualAddress:0xDFF1CE reason:NCReason_Automatic]; [file setInlineComment:@"Vertical line for VBLANK stop" atVirtualAddress:0xDFF1CE reason:CCReason_Automatic];
-    [file setName:@"SPRHSTRT" forVirtualAddress:0xDFF1D0 reason:NCReason_Automatic]; [file setInlineComment:@"UHRES sprite vertical start" atVirtualAddress:0xDFF1D0 reason:CCReason_Automatic];
-    [file setName:@"SPRHSTOP" forVirtualAddress:0xDFF1D2 reason:NCReason_Automatic]; [file setInlineComment:@"UHRES sprite vertical stop" atVirtualAddress:0xDFF1D2 reason:CCReason_Automatic];
-    [file setName:@"BPLHSTRT" forVirtualAddress:0xDFF1D4 reason:NCReason_Automatic]; [file setInlineComment:@"UHRES bit plane vertical start" atVirtualAddress:0xDFF1D4 reason:CCReason_Automatic];
-    [file setName:@"BPLHSTOP" forVirtualAddress:0xDFF1D6 reason:NCReason_Automatic]; [file setInlineComment:@"UHRES bit plane vertical stop" atVirtualAddress:0xDFF1D6 reason:CCReason_Automatic];
-    [file setName:@"HHPOSW" forVirtualAddress:0xDFF1D8 reason:NCReason_Automatic]; [file setInlineComment:@"DUAL mode hires H beam counter write" atVirtualAddress:0xDFF1D8 reason:CCReason_Automatic];
-    [file setName:@"HHPOSR" forVirtualAddress:0xDFF1DA reason:NCReason_Automatic]; [file setInlineComment:@"DUAL mode hires H beam counter read" atVirtualAddress:0xDFF1DA reason:CCReason_Automatic];
-    [file setName:@"BEAMCON0" forVirtualAddress:0xDFF1DC reason:NCReason_Automatic]; [file setInlineComment:@"Beam counter control register (SHRES,UHRES,PAL)" atVirtualAddress:0xDFF1DC reason:CCReason_Automatic];
-    [file setName:@"HSSTRT" forVirtualAddress:0xDFF1DE reason:NCReason_Automatic]; [file setInlineComment:@"Horizontal sync start (VARHSY)" atVirtualAddress:0xDFF1DE reason:CCReason_Automatic];
-    [file setName:@"VSSTRT" forVirtualAddress:0xDFF1E0 reason:NCReason_Automatic]; [file setInlineComment:@"Vertical sync start (VARVSY)" atVirtualAddress:0xDFF1E0 reason:CCReason_Automatic];
-    [file setName:@"HCENTER" forVirtualAddress:0xDFF1E2 reason:NCReason_Automatic]; [file setInlineComment:@"Horizontal position for Vsync on interlace" atVirtualAddress:0xDFF1E2 reason:CCReason_Automatic];
-    [file setName:@"DIWHIGH" forVirtualAddress:0xDFF1E4 reason:NCReason_Automatic]; [file setInlineComment:@"Display window - upper bits for start/stop" atVirtualAddress:0xDFF1E4 reason:CCReason_Automatic];
-    [file setName:@"BPLHMOD" forVirtualAddress:0xDFF1E6 reason:NCReason_Automatic]; [file setInlineComment:@"UHRES bit plane modulo" atVirtualAddress:0xDFF1E6 reason:CCReason_Automatic];
-    [file setName:@"SPRHPTH" forVirtualAddress:0xDFF1E8 reason:NCReason_Automatic]; [file setInlineComment:@"UHRES sprite pointer (high 5 bits)" atVirtualAddress:0xDFF1E8 reason:CCReason_Automatic];
-    [file setName:@"SPRHPTL" forVirtualAddress:0xDFF1EA reason:NCReason_Automatic]; [file setInlineComment:@"UHRES sprite pointer (low 15 bits)" atVirtualAddress:0xDFF1EA reason:CCReason_Automatic];
-    [file setName:@"BPLHPTH" forVirtualAddress:0xDFF1EC reason:NCReason_Automatic]; [file setInlineComment:@"VRam (UHRES) bitplane pointer (hi 5 bits)" atVirtualAddress:0xDFF1EC reason:CCReason_Automatic];
-    [file setName:@"BPLHPTL" forVirtualAddress:0xDFF1EE reason:NCReason_Automatic]; [file setInlineComment:@"VRam (UHRES) bitplane pointer (lo 15 bits)" atVirtualAddress:0xDFF1EE reason:CCReason_Automatic];
-    [file setName:@"FMODE" forVirtualAddress:0xDFF1FC reason:NCReason_Automatic]; [file setInlineComment:@"mode register" atVirtualAddress:0xDFF1FC reason:CCReason_Automatic];
+    addKnownAddresses(file, amigaCIARegisters, sizeof(amigaCIARegisters) / sizeof(amigaCIARegisters[0]));
+    addKnownAddresses(file, amigaCustomRegisters, sizeof(amigaCustomRegisters) / sizeof(amigaCustomRegisters[0]));
 
     
     return DIS_OK;
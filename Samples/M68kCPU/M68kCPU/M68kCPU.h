@@ -8,6 +8,7 @@
 
 #import <Foundation/Foundation.h>
 #import <Hopper/Hopper.h>
+#import "M68kInstructions.h"
 
 typedef NS_ENUM(NSUInteger, M68kRegClass) {
     RegClass_AddressRegister = RegClass_FirstUserClass,
@@ -25,6 +26,14 @@ typedef NS_ENUM(NSUInteger, M68kIncrement) {
 #define DISASM_M68K_OP_USER_INCREMENT         0
 #define DISASM_M68K_OP_USER_INDEX_REG_CLASS   1
 #define DISASM_M68K_OP_USER_REGLIST           2
+#define M68K_OP_USER_DATA_COUNT               3
+
+// Name of a register, for the given syntax variant, or NULL if the register is unknown.
+const char *M68kRegisterName(NSUInteger reg, RegClass reg_class, NSUInteger syntaxIndex);
+
+// The M68kInstruction of a Capstone instruction identifier, and the name of an instruction, or NULL.
+uint16_t M68kInstructionFromCapstone(unsigned int capstoneID);
+const char *M68kInstructionName(uint16_t instruction);
 
 @interface M68kCPU : NSObject<CPUDefinition>
 
@@ -8,15 +8,922 @@
 
 #import "M68kCPU.h"
 #import "M68kCtx.h"
+#import <capstone/capstone.h>
 
-#ifdef LINUX
-#include <endian.h>
+// Register names, as C strings, indexed by [syntaxIndex][reg].
 
-void OSWriteBigInt16(void *address, uintptr_t offset, int16_t data) {
-    *(int16_t *) ((uintptr_t) address + offset) = htobe16(data);
+static const char * const m68kCPUStateRegisterNames[2][21] = {
+    {
+        "sr", "ccr", "sfc", "dfc", "usp", "vbr",
+        "cacr", "caar", "msp", "isp", "tc", "itt0",
+        "itt1", "dtt0", "dtt1", "mmusr", "urp", "srp",
+        "fpcr", "fpsr", "fpiar"
+    },
+    {
+        "SR", "CCR", "SFC", "DFC", "USP", "VBR",
+        "CACR", "CAAR", "MSP", "ISP", "TC", "ITT0",
+        "ITT1", "DTT0", "DTT1", "MMUSR", "URP", "SRP",
+        "FPCR", "FPSR", "FPIAR"
+    }
+};
+
+static const char * const m68kDataRegisterNames[2][8] = {
+    {
+        "d0", "d1", "d2", "d3", "d4", "d5", "d6", "d7"
+    },
+    {
+        "D0", "D1", "D2", "D3", "D4", "D5", "D6", "D7"
+    }
+};
+
+static const char * const m68kAddressRegisterNames[2][9] = {
+    {
+        "a0", "a1", "a2", "a3", "a4", "a5", "a6", "a7",
+        "pc"
+    },
+    {
+        "A0", "A1", "A2", "A3", "A4", "A5", "A6", "A7",
+        "PC"
+    }
+};
+
+static const char * const m68kFPRegisterNames[2][8] = {
+    {
+        "fp0", "fp1", "fp2", "fp3", "fp4", "fp5", "fp6", "fp7"
+    },
+    {
+        "FP0", "FP1", "FP2", "FP3", "FP4", "FP5", "FP6", "FP7"
+    }
+};
+
+static const char * const m68kStackRegisterNames[2][32] = {
+    {
+        "stk0", "stk1", "stk2", "stk3", "stk4", "stk5", "stk6", "stk7",
+        "stk8", "stk9", "stk10", "stk11", "stk12", "stk13", "stk14", "stk15",
+        "stk16", "stk17", "stk18", "stk19", "stk20", "stk21", "stk22", "stk23",
+        "stk24", "stk25", "stk26", "stk27", "stk28", "stk29", "stk30", "stk31"
+    },
+    {
+        "STK0", "STK1", "STK2", "STK3", "STK4", "STK5", "STK6", "STK7",
+        "STK8", "STK9", "STK10", "STK11", "STK12", "STK13", "STK14", "STK15",
+        "STK16", "STK17", "STK18", "STK19", "STK20", "STK21", "STK22", "STK23",
+        "STK24", "STK25", "STK26", "STK27", "STK28", "STK29", "STK30", "STK31"
+    }
+};
+
+const char *M68kRegisterName(NSUInteger reg, RegClass reg_class, NSUInteger syntaxIndex) {
+    NSUInteger variant = (syntaxIndex == 1) ? 1 : 0;
+    switch (reg_class) {
+        case RegClass_CPUState: return (reg < 21) ? m68kCPUStateRegisterNames[variant][reg] : NULL;
+        case RegClass_PseudoRegisterSTACK: return (reg < 32) ? m68kStackRegisterNames[variant][reg] : NULL;
+        case RegClass_GeneralPurposeRegister: return (reg < 8) ? m68kDataRegisterNames[variant][reg] : NULL;
+        case RegClass_AddressRegister: return (reg < 9) ? m68kAddressRegisterNames[variant][reg] : NULL;
+        case RegClass_FPRegister: return (reg < 8) ? m68kFPRegisterNames[variant][reg] : NULL;
+        default: break;
+    }
+    return NULL;
+}
+
+// Instruction identifiers, see M68kInstructions.h.
+
+static const uint16_t m68kCapstoneInstructions[M68K_INS_ENDING] = {
+    [M68K_INS_INVALID] = M68kInstruction_Invalid,
+    [M68K_INS_ABCD] = M68kInstruction_ABCD,
+    [M68K_INS_ADD] = M68kInstruction_ADD,
+    [M68K_INS_ADDA] = M68kInstruction_ADDA,
+    [M68K_INS_ADDI] = M68kInstruction_ADDI,
+    [M68K_INS_ADDQ] = M68kInstruction_ADDQ,
+    [M68K_INS_ADDX] = M68kInstruction_ADDX,
+    [M68K_INS_AND] = M68kInstruction_AND,
+    [M68K_INS_ANDI] = M68kInstruction_ANDI,
+    [M68K_INS_ASL] = M68kInstruction_ASL,
+    [M68K_INS_ASR] = M68kInstruction_ASR,
+    [M68K_INS_BHS] = M68kInstruction_BHS,
+    [M68K_INS_BLO] = M68kInstruction_BLO,
+    [M68K_INS_BHI] = M68kInstruction_BHI,
+    [M68K_INS_BLS] = M68kInstruction_BLS,
+    [M68K_INS_BCC] = M68kInstruction_BCC,
+    [M68K_INS_BCS] = M68kInstruction_BCS,
+    [M68K_INS_BNE] = M68kInstruction_BNE,
+    [M68K_INS_BEQ] = M68kInstruction_BEQ,
+    [M68K_INS_BVC] = M68kInstruction_BVC,
+    [M68K_INS_BVS] = M68kInstruction_BVS,
+    [M68K_INS_BPL] = M68kInstruction_BPL,
+    [M68K_INS_BMI] = M68kInstruction_BMI,
+    [M68K_INS_BGE] = M68kInstruction_BGE,
+    [M68K_INS_BLT] = M68kInstruction_BLT,
+    [M68K_INS_BGT] = M68kInstruction_BGT,
+    [M68K_INS_BLE] = M68kInstruction_BLE,
+    [M68K_INS_BRA] = M68kInstruction_BRA,
+    [M68K_INS_BSR] = M68kInstruction_BSR,
+    [M68K_INS_BCHG] = M68kInstruction_BCHG,
+    [M68K_INS_BCLR] = M68kInstruction_BCLR,
+    [M68K_INS_BSET] = M68kInstruction_BSET,
+    [M68K_INS_BTST] = M68kInstruction_BTST,
+    [M68K_INS_BFCHG] = M68kInstruction_BFCHG,
+    [M68K_INS_BFCLR] = M68kInstruction_BFCLR,
+    [M68K_INS_BFEXTS] = M68kInstruction_BFEXTS,
+    [M68K_INS_BFEXTU] = M68kInstruction_BFEXTU,
+    [M68K_INS_BFFFO] = M68kInstruction_BFFFO,
+    [M68K_INS_BFINS] = M68kInstruction_BFINS,
+    [M68K_INS_BFSET] = M68kInstruction_BFSET,
+    [M68K_INS_BFTST] = M68kInstruction_BFTST,
+    [M68K_INS_BKPT] = M68kInstruction_BKPT,
+    [M68K_INS_CALLM] = M68kInstruction_CALLM,
+    [M68K_INS_CAS] = M68kInstruction_CAS,
+    [M68K_INS_CAS2] = M68kInstruction_CAS2,
+    [M68K_INS_CHK] = M68kInstruction_CHK,
+    [M68K_INS_CHK2] = M68kInstruction_CHK2,
+    [M68K_INS_CLR] = M68kInstruction_CLR,
+    [M68K_INS_CMP] = M68kInstruction_CMP,
+    [M68K_INS_CMPA] = M68kInstruction_CMPA,
+    [M68K_INS_CMPI] = M68kInstruction_CMPI,
+    [M68K_INS_CMPM] = M68kInstruction_CMPM,
+    [M68K_INS_CMP2] = M68kInstruction_CMP2,
+    [M68K_INS_CINVL] = M68kInstruction_CINVL,
+    [M68K_INS_CINVP] = M68kInstruction_CINVP,
+    [M68K_INS_CINVA] = M68kInstruction_CINVA,
+    [M68K_INS_CPUSHL] = M68kInstruction_CPUSHL,
+    [M68K_INS_CPUSHP] = M68kInstruction_CPUSHP,
+    [M68K_INS_CPUSHA] = M68kInstruction_CPUSHA,
+    [M68K_INS_DBT] = M68kInstruction_DBT,
+    [M68K_INS_DBF] = M68kInstruction_DBF,
+    [M68K_INS_DBHI] = M68kInstruction_DBHI,
+    [M68K_INS_DBLS] = M68kInstruction_DBLS,
+    [M68K_INS_DBCC] = M68kInstruction_DBCC,
+    [M68K_INS_DBCS] = M68kInstruction_DBCS,
+    [M68K_INS_DBNE] = M68kInstruction_DBNE,
+    [M68K_INS_DBEQ] = M68kInstruction_DBEQ,
+    [M68K_INS_DBVC] = M68kInstruction_DBVC,
+    [M68K_INS_DBVS] = M68kInstruction_DBVS,
+    [M68K_INS_DBPL] = M68kInstruction_DBPL,
+    [M68K_INS_DBMI] = M68kInstruction_DBMI,
+    [M68K_INS_DBGE] = M68kInstruction_DBGE,
+    [M68K_INS_DBLT] = M68kInstruction_DBLT,
+    [M68K_INS_DBGT] = M68kInstruction_DBGT,
+    [M68K_INS_DBLE] = M68kInstruction_DBLE,
+    [M68K_INS_DBRA] = M68kInstruction_DBRA,
+    [M68K_INS_DIVS] = M68kInstruction_DIVS,
+    [M68K_INS_DIVSL] = M68kInstruction_DIVSL,
+    [M68K_INS_DIVU] = M68kInstruction_DIVU,
+    [M68K_INS_DIVUL] = M68kInstruction_DIVUL,
+    [M68K_INS_EOR] = M68kInstruction_EOR,
+    [M68K_INS_EORI] = M68kInstruction_EORI,
+    [M68K_INS_EXG] = M68kInstruction_EXG,
+    [M68K_INS_EXT] = M68kInstruction_EXT,
+    [M68K_INS_EXTB] = M68kInstruction_EXTB,
+    [M68K_INS_FABS] = M68kInstruction_FABS,
+    [M68K_INS_FSABS] = M68kInstruction_FSABS,
+    [M68K_INS_FDABS] = M68kInstruction_FDABS,
+    [M68K_INS_FACOS] = M68kInstruction_FACOS,
+    [M68K_INS_FADD] = M68kInstruction_FADD,
+    [M68K_INS_FSADD] = M68kInstruction_FSADD,
+    [M68K_INS_FDADD] = M68kInstruction_FDADD,
+    [M68K_INS_FASIN] = M68kInstruction_FASIN,
+    [M68K_INS_FATAN] = M68kInstruction_FATAN,
+    [M68K_INS_FATANH] = M68kInstruction_FATANH,
+    [M68K_INS_FBF] = M68kInstruction_FBF,
+    [M68K_INS_FBEQ] = M68kInstruction_FBEQ,
+    [M68K_INS_FBOGT] = M68kInstruction_FBOGT,
+    [M68K_INS_FBOGE] = M68kInstruction_FBOGE,
+    [M68K_INS_FBOLT] = M68kInstruction_FBOLT,
+    [M68K_INS_FBOLE] = M68kInstruction_FBOLE,
+    [M68K_INS_FBOGL] = M68kInstruction_FBOGL,
+    [M68K_INS_FBOR] = M68kInstruction_FBOR,
+    [M68K_INS_FBUN] = M68kInstruction_FBUN,
+    [M68K_INS_FBUEQ] = M68kInstruction_FBUEQ,
+    [M68K_INS_FBUGT] = M68kInstruction_FBUGT,
+    [M68K_INS_FBUGE] = M68kInstruction_FBUGE,
+    [M68K_INS_FBULT] = M68kInstruction_FBULT,
+    [M68K_INS_FBULE] = M68kInstruction_FBULE,
+    [M68K_INS_FBNE] = M68kInstruction_FBNE,
+    [M68K_INS_FBT] = M68kInstruction_FBT,
+    [M68K_INS_FBSF] = M68kInstruction_FBSF,
+    [M68K_INS_FBSEQ] = M68kInstruction_FBSEQ,
+    [M68K_INS_FBGT] = M68kInstruction_FBGT,
+    [M68K_INS_FBGE] = M68kInstruction_FBGE,
+    [M68K_INS_FBLT] = M68kInstruction_FBLT,
+    [M68K_INS_FBLE] = M68kInstruction_FBLE,
+    [M68K_INS_FBGL] = M68kInstruction_FBGL,
+    [M68K_INS_FBGLE] = M68kInstruction_FBGLE,
+    [M68K_INS_FBNGLE] = M68kInstruction_FBNGLE,
+    [M68K_INS_FBNGL] = M68kInstruction_FBNGL,
+    [M68K_INS_FBNLE] = M68kInstruction_FBNLE,
+    [M68K_INS_FBNLT] = M68kInstruction_FBNLT,
+    [M68K_INS_FBNGE] = M68kInstruction_FBNGE,
+    [M68K_INS_FBNGT] = M68kInstruction_FBNGT,
+    [M68K_INS_FBSNE] = M68kInstruction_FBSNE,
+    [M68K_INS_FBST] = M68kInstruction_FBST,
+    [M68K_INS_FCMP] = M68kInstruction_FCMP,
+    [M68K_INS_FCOS] = M68kInstruction_FCOS,
+    [M68K_INS_FCOSH] = M68kInstruction_FCOSH,
+    [M68K_INS_FDBF] = M68kInstruction_FDBF,
+    [M68K_INS_FDBEQ] = M68kInstruction_FDBEQ,
+    [M68K_INS_FDBOGT] = M68kInstruction_FDBOGT,
+    [M68K_INS_FDBOGE] = M68kInstruction_FDBOGE,
+    [M68K_INS_FDBOLT] = M68kInstruction_FDBOLT,
+    [M68K_INS_FDBOLE] = M68kInstruction_FDBOLE,
+    [M68K_INS_FDBOGL] = M68kInstruction_FDBOGL,
+    [M68K_INS_FDBOR] = M68kInstruction_FDBOR,
+    [M68K_INS_FDBUN] = M68kInstruction_FDBUN,
+    [M68K_INS_FDBUEQ] = M68kInstruction_FDBUEQ,
+    [M68K_INS_FDBUGT] = M68kInstruction_FDBUGT,
+    [M68K_INS_FDBUGE] = M68kInstruction_FDBUGE,
+    [M68K_INS_FDBULT] = M68kInstruction_FDBULT,
+    [M68K_INS_FDBULE] = M68kInstruction_FDBULE,
+    [M68K_INS_FDBNE] = M68kInstruction_FDBNE,
+    [M68K_INS_FDBT] = M68kInstruction_FDBT,
+    [M68K_INS_FDBSF] = M68kInstruction_FDBSF,
+    [M68K_INS_FDBSEQ] = M68kInstruction_FDBSEQ,
+    [M68K_INS_FDBGT] = M68kInstruction_FDBGT,
+    [M68K_INS_FDBGE] = M68kInstruction_FDBGE,
+    [M68K_INS_FDBLT] = M68kInstruction_FDBLT,
+    [M68K_INS_FDBLE] = M68kInstruction_FDBLE,
+    [M68K_INS_FDBGL] = M68kInstruction_FDBGL,
+    [M68K_INS_FDBGLE] = M68kInstruction_FDBGLE,
+    [M68K_INS_FDBNGLE] = M68kInstruction_FDBNGLE,
+    [M68K_INS_FDBNGL] = M68kInstruction_FDBNGL,
+    [M68K_INS_FDBNLE] = M68kInstruction_FDBNLE,
+    [M68K_INS_FDBNLT] = M68kInstruction_FDBNLT,
+    [M68K_INS_FDBNGE] = M68kInstruction_FDBNGE,
+    [M68K_INS_FDBNGT] = M68kInstruction_FDBNGT,
+    [M68K_INS_FDBSNE] = M68kInstruction_FDBSNE,
+    [M68K_INS_FDBST] = M68kInstruction_FDBST,
+    [M68K_INS_FDIV] = M68kInstruction_FDIV,
+    [M68K_INS_FSDIV] = M68kInstruction_FSDIV,
+    [M68K_INS_FDDIV] = M68kInstruction_FDDIV,
+    [M68K_INS_FETOX] = M68kInstruction_FETOX,
+    [M68K_INS_FETOXM1] = M68kInstruction_FETOXM1,
+    [M68K_INS_FGETEXP] = M68kInstruction_FGETEXP,
+    [M68K_INS_FGETMAN] = M68kInstruction_FGETMAN,
+    [M68K_INS_FINT] = M68kInstruction_FINT,
+    [M68K_INS_FINTRZ] = M68kInstruction_FINTRZ,
+    [M68K_INS_FLOG10] = M68kInstruction_FLOG10,
+    [M68K_INS_FLOG2] = M68kInstruction_FLOG2,
+    [M68K_INS_FLOGN] = M68kInstruction_FLOGN,
+    [M68K_INS_FLOGNP1] = M68kInstruction_FLOGNP1,
+    [M68K_INS_FMOD] = M68kInstruction_FMOD,
+    [M68K_INS_FMOVE] = M68kInstruction_FMOVE,
+    [M68K_INS_FSMOVE] = M68kInstruction_FSMOVE,
+    [M68K_INS_FDMOVE] = M68kInstruction_FDMOVE,
+    [M68K_INS_FMOVECR] = M68kInstruction_FMOVECR,
+    [M68K_INS_FMOVEM] = M68kInstruction_FMOVEM,
+    [M68K_INS_FMUL] = M68kInstruction_FMUL,
+    [M68K_INS_FSMUL] = M68kInstruction_FSMUL,
+    [M68K_INS_FDMUL] = M68kInstruction_FDMUL,
+    [M68K_INS_FNEG] = M68kInstruction_FNEG,
+    [M68K_INS_FSNEG] = M68kInstruction_FSNEG,
+    [M68K_INS_FDNEG] = M68kInstruction_FDNEG,
+    [M68K_INS_FNOP] = M68kInstruction_FNOP,
+    [M68K_INS_FREM] = M68kInstruction_FREM,
+    [M68K_INS_FRESTORE] = M68kInstruction_FRESTORE,
+    [M68K_INS_FSAVE] = M68kInstruction_FSAVE,
+    [M68K_INS_FSCALE] = M68kInstruction_FSCALE,
+    [M68K_INS_FSGLDIV] = M68kInstruction_FSGLDIV,
+    [M68K_INS_FSGLMUL] = M68kInstruction_FSGLMUL,
+    [M68K_INS_FSIN] = M68kInstruction_FSIN,
+    [M68K_INS_FSINCOS] = M68kInstruction_FSINCOS,
+    [M68K_INS_FSINH] = M68kInstruction_FSINH,
+    [M68K_INS_FSQRT] = M68kInstruction_FSQRT,
+    [M68K_INS_FSSQRT] = M68kInstruction_FSSQRT,
+    [M68K_INS_FDSQRT] = M68kInstruction_FDSQRT,
+    [M68K_INS_FSF] = M68kInstruction_FSF,
+    [M68K_INS_FSBEQ] = M68kInstruction_FSBEQ,
+    [M68K_INS_FSOGT] = M68kInstruction_FSOGT,
+    [M68K_INS_FSOGE] = M68kInstruction_FSOGE,
+    [M68K_INS_FSOLT] = M68kInstruction_FSOLT,
+    [M68K_INS_FSOLE] = M68kInstruction_FSOLE,
+    [M68K_INS_FSOGL] = M68kInstruction_FSOGL,
+    [M68K_INS_FSOR] = M68kInstruction_FSOR,
+    [M68K_INS_FSUN] = M68kInstruction_FSUN,
+    [M68K_INS_FSUEQ] = M68kInstruction_FSUEQ,
+    [M68K_INS_FSUGT] = M68kInstruction_FSUGT,
+    [M68K_INS_FSUGE] = M68kInstruction_FSUGE,
+    [M68K_INS_FSULT] = M68kInstruction_FSULT,
+    [M68K_INS_FSULE] = M68kInstruction_FSULE,
+    [M68K_INS_FSNE] = M68kInstruction_FSNE,
+    [M68K_INS_FST] = M68kInstruction_FST,
+    [M68K_INS_FSSF] = M68kInstruction_FSSF,
+    [M68K_INS_FSSEQ] = M68kInstruction_FSSEQ,
+    [M68K_INS_FSGT] = M68kInstruction_FSGT,
+    [M68K_INS_FSGE] = M68kInstruction_FSGE,
+    [M68K_INS_FSLT] = M68kInstruction_FSLT,
+    [M68K_INS_FSLE] = M68kInstruction_FSLE,
+    [M68K_INS_FSGL] = M68kInstruction_FSGL,
+    [M68K_INS_FSGLE] = M68kInstruction_FSGLE,
+    [M68K_INS_FSNGLE] = M68kInstruction_FSNGLE,
+    [M68K_INS_FSNGL] = M68kInstruction_FSNGL,
+    [M68K_INS_FSNLE] = M68kInstruction_FSNLE,
+    [M68K_INS_FSNLT] = M68kInstruction_FSNLT,
+    [M68K_INS_FSNGE] = M68kInstruction_FSNGE,
+    [M68K_INS_FSNGT] = M68kInstruction_FSNGT,
+    [M68K_INS_FSSNE] = M68kInstruction_FSSNE,
+    [M68K_INS_FSST] = M68kInstruction_FSST,
+    [M68K_INS_FSUB] = M68kInstruction_FSUB,
+    [M68K_INS_FSSUB] = M68kInstruction_FSSUB,
+    [M68K_INS_FDSUB] = M68kInstruction_FDSUB,
+    [M68K_INS_FTAN] = M68kInstruction_FTAN,
+    [M68K_INS_FTANH] = M68kInstruction_FTANH,
+    [M68K_INS_FTENTOX] = M68kInstruction_FTENTOX,
+    [M68K_INS_FTRAPF] = M68kInstruction_FTRAPF,
+    [M68K_INS_FTRAPEQ] = M68kInstruction_FTRAPEQ,
+    [M68K_INS_FTRAPOGT] = M68kInstruction_FTRAPOGT,
+    [M68K_INS_FTRAPOGE] = M68kInstruction_FTRAPOGE,
+    [M68K_INS_FTRAPOLT] = M68kInstruction_FTRAPOLT,
+    [M68K_INS_FTRAPOLE] = M68kInstruction_FTRAPOLE,
+    [M68K_INS_FTRAPOGL] = M68kInstruction_FTRAPOGL,
+    [M68K_INS_FTRAPOR] = M68kInstruction_FTRAPOR,
+    [M68K_INS_FTRAPUN] = M68kInstruction_FTRAPUN,
+    [M68K_INS_FTRAPUEQ] = M68kInstruction_FTRAPUEQ,
+    [M68K_INS_FTRAPUGT] = M68kInstruction_FTRAPUGT,
+    [M68K_INS_FTRAPUGE] = M68kInstruction_FTRAPUGE,
+    [M68K_INS_FTRAPULT] = M68kInstruction_FTRAPULT,
+    [M68K_INS_FTRAPULE] = M68kInstruction_FTRAPULE,
+    [M68K_INS_FTRAPNE] = M68kInstruction_FTRAPNE,
+    [M68K_INS_FTRAPT] = M68kInstruction_FTRAPT,
+    [M68K_INS_FTRAPSF] = M68kInstruction_FTRAPSF,
+    [M68K_INS_FTRAPSEQ] = M68kInstruction_FTRAPSEQ,
+    [M68K_INS_FTRAPGT] = M68kInstruction_FTRAPGT,
+    [M68K_INS_FTRAPGE] = M68kInstruction_FTRAPGE,
+    [M68K_INS_FTRAPLT] = M68kInstruction_FTRAPLT,
+    [M68K_INS_FTRAPLE] = M68kInstruction_FTRAPLE,
+    [M68K_INS_FTRAPGL] = M68kInstruction_FTRAPGL,
+    [M68K_INS_FTRAPGLE] = M68kInstruction_FTRAPGLE,
+    [M68K_INS_FTRAPNGLE] = M68kInstruction_FTRAPNGLE,
+    [M68K_INS_FTRAPNGL] = M68kInstruction_FTRAPNGL,
+    [M68K_INS_FTRAPNLE] = M68kInstruction_FTRAPNLE,
+    [M68K_INS_FTRAPNLT] = M68kInstruction_FTRAPNLT,
+    [M68K_INS_FTRAPNGE] = M68kInstruction_FTRAPNGE,
+    [M68K_INS_FTRAPNGT] = M68kInstruction_FTRAPNGT,
+    [M68K_INS_FTRAPSNE] = M68kInstruction_FTRAPSNE,
+    [M68K_INS_FTRAPST] = M68kInstruction_FTRAPST,
+    [M68K_INS_FTST] = M68kInstruction_FTST,
+    [M68K_INS_FTWOTOX] = M68kInstruction_FTWOTOX,
+    [M68K_INS_HALT] = M68kInstruction_HALT,
+    [M68K_INS_ILLEGAL] = M68kInstruction_ILLEGAL,
+    [M68K_INS_JMP] = M68kInstruction_JMP,
+    [M68K_INS_JSR] = M68kInstruction_JSR,
+    [M68K_INS_LEA] = M68kInstruction_LEA,
+    [M68K_INS_LINK] = M68kInstruction_LINK,
+    [M68K_INS_LPSTOP] = M68kInstruction_LPSTOP,
+    [M68K_INS_LSL] = M68kInstruction_LSL,
+    [M68K_INS_LSR] = M68kInstruction_LSR,
+    [M68K_INS_MOVE] = M68kInstruction_MOVE,
+    [M68K_INS_MOVEA] = M68kInstruction_MOVEA,
+    [M68K_INS_MOVEC] = M68kInstruction_MOVEC,
+    [M68K_INS_MOVEM] = M68kInstruction_MOVEM,
+    [M68K_INS_MOVEP] = M68kInstruction_MOVEP,
+    [M68K_INS_MOVEQ] = M68kInstruction_MOVEQ,
+    [M68K_INS_MOVES] = M68kInstruction_MOVES,
+    [M68K_INS_MOVE16] = M68kInstruction_MOVE16,
+    [M68K_INS_MULS] = M68kInstruction_MULS,
+    [M68K_INS_MULU] = M68kInstruction_MULU,
+    [M68K_INS_NBCD] = M68kInstruction_NBCD,
+    [M68K_INS_NEG] = M68kInstruction_NEG,
+    [M68K_INS_NEGX] = M68kInstruction_NEGX,
+    [M68K_INS_NOP] = M68kInstruction_NOP,
+    [M68K_INS_NOT] = M68kInstruction_NOT,
+    [M68K_INS_OR] = M68kInstruction_OR,
+    [M68K_INS_ORI] = M68kInstruction_ORI,
+    [M68K_INS_PACK] = M68kInstruction_PACK,
+    [M68K_INS_PEA] = M68kInstruction_PEA,
+    [M68K_INS_PFLUSH] = M68kInstruction_PFLUSH,
+    [M68K_INS_PFLUSHA] = M68kInstruction_PFLUSHA,
+    [M68K_INS_PFLUSHAN] = M68kInstruction_PFLUSHAN,
+    [M68K_INS_PFLUSHN] = M68kInstruction_PFLUSHN,
+    [M68K_INS_PLOADR] = M68kInstruction_PLOADR,
+    [M68K_INS_PLOADW] = M68kInstruction_PLOADW,
+    [M68K_INS_PLPAR] = M68kInstruction_PLPAR,
+    [M68K_INS_PLPAW] = M68kInstruction_PLPAW,
+    [M68K_INS_PMOVE] = M68kInstruction_PMOVE,
+    [M68K_INS_PMOVEFD] = M68kInstruction_PMOVEFD,
+    [M68K_INS_PTESTR] = M68kInstruction_PTESTR,
+    [M68K_INS_PTESTW] = M68kInstruction_PTESTW,
+    [M68K_INS_PULSE] = M68kInstruction_PULSE,
+    [M68K_INS_REMS] = M68kInstruction_REMS,
+    [M68K_INS_REMU] = M68kInstruction_REMU,
+    [M68K_INS_RESET] = M68kInstruction_RESET,
+    [M68K_INS_ROL] = M68kInstruction_ROL,
+    [M68K_INS_ROR] = M68kInstruction_ROR,
+    [M68K_INS_ROXL] = M68kInstruction_ROXL,
+    [M68K_INS_ROXR] = M68kInstruction_ROXR,
+    [M68K_INS_RTD] = M68kInstruction_RTD,
+    [M68K_INS_RTE] = M68kInstruction_RTE,
+    [M68K_INS_RTM] = M68kInstruction_RTM,
+    [M68K_INS_RTR] = M68kInstruction_RTR,
+    [M68K_INS_RTS] = M68kInstruction_RTS,
+    [M68K_INS_SBCD] = M68kInstruction_SBCD,
+    [M68K_INS_ST] = M68kInstruction_ST,
+    [M68K_INS_SF] = M68kInstruction_SF,
+    [M68K_INS_SHI] = M68kInstruction_SHI,
+    [M68K_INS_SLS] = M68kInstruction_SLS,
+    [M68K_INS_SCC] = M68kInstruction_SCC,
+    [M68K_INS_SHS] = M68kInstruction_SHS,
+    [M68K_INS_SCS] = M68kInstruction_SCS,
+    [M68K_INS_SLO] = M68kInstruction_SLO,
+    [M68K_INS_SNE] = M68kInstruction_SNE,
+    [M68K_INS_SEQ] = M68kInstruction_SEQ,
+    [M68K_INS_SVC] = M68kInstruction_SVC,
+    [M68K_INS_SVS] = M68kInstruction_SVS,
+    [M68K_INS_SPL] = M68kInstruction_SPL,
+    [M68K_INS_SMI] = M68kInstruction_SMI,
+    [M68K_INS_SGE] = M68kInstruction_SGE,
+    [M68K_INS_SLT] = M68kInstruction_SLT,
+    [M68K_INS_SGT] = M68kInstruction_SGT,
+    [M68K_INS_SLE] = M68kInstruction_SLE,
+    [M68K_INS_STOP] = M68kInstruction_STOP,
+    [M68K_INS_SUB] = M68kInstruction_SUB,
+    [M68K_INS_SUBA] = M68kInstruction_SUBA,
+    [M68K_INS_SUBI] = M68kInstruction_SUBI,
+    [M68K_INS_SUBQ] = M68kInstruction_SUBQ,
+    [M68K_INS_SUBX] = M68kInstruction_SUBX,
+    [M68K_INS_SWAP] = M68kInstruction_SWAP,
+    [M68K_INS_TAS] = M68kInstruction_TAS,
+    [M68K_INS_TRAP] = M68kInstruction_TRAP,
+    [M68K_INS_TRAPV] = M68kInstruction_TRAPV,
+    [M68K_INS_TRAPT] = M68kInstruction_TRAPT,
+    [M68K_INS_TRAPF] = M68kInstruction_TRAPF,
+    [M68K_INS_TRAPHI] = M68kInstruction_TRAPHI,
+    [M68K_INS_TRAPLS] = M68kInstruction_TRAPLS,
+    [M68K_INS_TRAPCC] = M68kInstruction_TRAPCC,
+    [M68K_INS_TRAPHS] = M68kInstruction_TRAPHS,
+    [M68K_INS_TRAPCS] = M68kInstruction_TRAPCS,
+    [M68K_INS_TRAPLO] = M68kInstruction_TRAPLO,
+    [M68K_INS_TRAPNE] = M68kInstruction_TRAPNE,
+    [M68K_INS_TRAPEQ] = M68kInstruction_TRAPEQ,
+    [M68K_INS_TRAPVC] = M68kInstruction_TRAPVC,
+    [M68K_INS_TRAPVS] = M68kInstruction_TRAPVS,
+    [M68K_INS_TRAPPL] = M68kInstruction_TRAPPL,
+    [M68K_INS_TRAPMI] = M68kInstruction_TRAPMI,
+    [M68K_INS_TRAPGE] = M68kInstruction_TRAPGE,
+    [M68K_INS_TRAPLT] = M68kInstruction_TRAPLT,
+    [M68K_INS_TRAPGT] = M68kInstruction_TRAPGT,
+    [M68K_INS_TRAPLE] = M68kInstruction_TRAPLE,
+    [M68K_INS_TST] = M68kInstruction_TST,
+    [M68K_INS_UNLK] = M68kInstruction_UNLK,
+    [M68K_INS_UNPK] = M68kInstruction_UNPK,
+};
+
+static const char * const m68kInstructionNames[M68kInstruction_Count] = {
+    [M68kInstruction_Invalid] = "invalid",
+    [M68kInstruction_ABCD] = "abcd",
+    [M68kInstruction_ADD] = "add",
+    [M68kInstruction_ADDA] = "adda",
+    [M68kInstruction_ADDI] = "addi",
+    [M68kInstruction_ADDQ] = "addq",
+    [M68kInstruction_ADDX] = "addx",
+    [M68kInstruction_AND] = "and",
+    [M68kInstruction_ANDI] = "andi",
+    [M68kInstruction_ASL] = "asl",
+    [M68kInstruction_ASR] = "asr",
+    [M68kInstruction_BHS] = "bhs",
+    [M68kInstruction_BLO] = "blo",
+    [M68kInstruction_BHI] = "bhi",
+    [M68kInstruction_BLS] = "bls",
+    [M68kInstruction_BCC] = "bcc",
+    [M68kInstruction_BCS] = "bcs",
+    [M68kInstruction_BNE] = "bne",
+    [M68kInstruction_BEQ] = "beq",
+    [M68kInstruction_BVC] = "bvc",
+    [M68kInstruction_BVS] = "bvs",
+    [M68kInstruction_BPL] = "bpl",
+    [M68kInstruction_BMI] = "bmi",
+    [M68kInstruction_BGE] = "bge",
+    [M68kInstruction_BLT] = "blt",
+    [M68kInstruction_BGT] = "bgt",
+    [M68kInstruction_BLE] = "ble",
+    [M68kInstruction_BRA] = "bra",
+    [M68kInstruction_BSR] = "bsr",
+    [M68kInstruction_BCHG] = "bchg",
+    [M68kInstruction_BCLR] = "bclr",
+    [M68kInstruction_BSET] = "bset",
+    [M68kInstruction_BTST] = "btst",
+    [M68kInstruction_BFCHG] = "bfchg",
+    [M68kInstruction_BFCLR] = "bfclr",
+    [M68kInstruction_BFEXTS] = "bfexts",
+    [M68kInstruction_BFEXTU] = "bfextu",
+    [M68kInstruction_BFFFO] = "bfffo",
+    [M68kInstruction_BFINS] = "bfins",
+    [M68kInstruction_BFSET] = "bfset",
+    [M68kInstruction_BFTST] = "bftst",
+    [M68kInstruction_BKPT] = "bkpt",
+    [M68kInstruction_CALLM] = "callm",
+    [M68kInstruction_CAS] = "cas",
+    [M68kInstruction_CAS2] = "cas2",
+    [M68kInstruction_CHK] = "chk",
+    [M68kInstruction_CHK2] = "chk2",
+    [M68kInstruction_CLR] = "clr",
+    [M68kInstruction_CMP] = "cmp",
+    [M68kInstruction_CMPA] = "cmpa",
+    [M68kInstruction_CMPI] = "cmpi",
+    [M68kInstruction_CMPM] = "cmpm",
+    [M68kInstruction_CMP2] = "cmp2",
+    [M68kInstruction_CINVL] = "cinvl",
+    [M68kInstruction_CINVP] = "cinvp",
+    [M68kInstruction_CINVA] = "cinva",
+    [M68kInstruction_CPUSHL] = "cpushl",
+    [M68kInstruction_CPUSHP] = "cpushp",
+    [M68kInstruction_CPUSHA] = "cpusha",
+    [M68kInstruction_DBT] = "dbt",
+    [M68kInstruction_DBF] = "dbf",
+    [M68kInstruction_DBHI] = "dbhi",
+    [M68kInstruction_DBLS] = "dbls",
+    [M68kInstruction_DBCC] = "dbcc",
+    [M68kInstruction_DBCS] = "dbcs",
+    [M68kInstruction_DBNE] = "dbne",
+    [M68kInstruction_DBEQ] = "dbeq",
+    [M68kInstruction_DBVC] = "dbvc",
+    [M68kInstruction_DBVS] = "dbvs",
+    [M68kInstruction_DBPL] = "dbpl",
+    [M68kInstruction_DBMI] = "dbmi",
+    [M68kInstruction_DBGE] = "dbge",
+    [M68kInstruction_DBLT] = "dblt",
+    [M68kInstruction_DBGT] = "dbgt",
+    [M68kInstruction_DBLE] = "dble",
+    [M68kInstruction_DBRA] = "dbra",
+    [M68kInstruction_DIVS] = "divs",
+    [M68kInstruction_DIVSL] = "divsl",
+    [M68kInstruction_DIVU] = "divu",
+    [M68kInstruction_DIVUL] = "divul",
+    [M68kInstruction_EOR] = "eor",
+    [M68kInstruction_EORI] = "eori",
+    [M68kInstruction_EXG] = "exg",
+    [M68kInstruction_EXT] = "ext",
+    [M68kInstruction_EXTB] = "extb",
+    [M68kInstruction_FABS] = "fabs",
+    [M68kInstruction_FSABS] = "fsabs",
+    [M68kInstruction_FDABS] = "fdabs",
+    [M68kInstruction_FACOS] = "facos",
+    [M68kInstruction_FADD] = "fadd",
+    [M68kInstruction_FSADD] = "fsadd",
+    [M68kInstruction_FDADD] = "fdadd",
+    [M68kInstruction_FASIN] = "fasin",
+    [M68kInstruction_FATAN] = "fatan",
+    [M68kInstruction_FATANH] = "fatanh",
+    [M68kInstruction_FBF] = "fbf",
+    [M68kInstruction_FBEQ] = "fbeq",
+    [M68kInstruction_FBOGT] = "fbogt",
+    [M68kInstruction_FBOGE] = "fboge",
+    [M68kInstruction_FBOLT] = "fbolt",
+    [M68kInstruction_FBOLE] = "fbole",
+    [M68kInstruction_FBOGL] = "fbogl",
+    [M68kInstruction_FBOR] = "fbor",
+    [M68kInstruction_FBUN] = "fbun",
+    [M68kInstruction_FBUEQ] = "fbueq",
+    [M68kInstruction_FBUGT] = "fbugt",
+    [M68kInstruction_FBUGE] = "fbuge",
+    [M68kInstruction_FBULT] = "fbult",
+    [M68kInstruction_FBULE] = "fbule",
+    [M68kInstruction_FBNE] = "fbne",
+    [M68kInstruction_FBT] = "fbt",
+    [M68kInstruction_FBSF] = "fbsf",
+    [M68kInstruction_FBSEQ] = "fbseq",
+    [M68kInstruction_FBGT] = "fbgt",
+    [M68kInstruction_FBGE] = "fbge",
+    [M68kInstruction_FBLT] = "fblt",
+    [M68kInstruction_FBLE] = "fble",
+    [M68kInstruction_FBGL] = "fbgl",
+    [M68kInstruction_FBGLE] = "fbgle",
+    [M68kInstruction_FBNGLE] = "fbngle",
+    [M68kInstruction_FBNGL] = "fbngl",
+    [M68kInstruction_FBNLE] = "fbnle",
+    [M68kInstruction_FBNLT] = "fbnlt",
+    [M68kInstruction_FBNGE] = "fbnge",
+    [M68kInstruction_FBNGT] = "fbngt",
+    [M68kInstruction_FBSNE] = "fbsne",
+    [M68kInstruction_FBST] = "fbst",
+    [M68kInstruction_FCMP] = "fcmp",
+    [M68kInstruction_FCOS] = "fcos",
+    [M68kInstruction_FCOSH] = "fcosh",
+    [M68kInstruction_FDBF] = "fdbf",
+    [M68kInstruction_FDBEQ] = "fdbeq",
+    [M68kInstruction_FDBOGT] = "fdbogt",
+    [M68kInstruction_FDBOGE] = "fdboge",
+    [M68kInstruction_FDBOLT] = "fdbolt",
+    [M68kInstruction_FDBOLE] = "fdbole",
+    [M68kInstruction_FDBOGL] = "fdbogl",
+    [M68kInstruction_FDBOR] = "fdbor",
+    [M68kInstruction_FDBUN] = "fdbun",
+    [M68kInstruction_FDBUEQ] = "fdbueq",
+    [M68kInstruction_FDBUGT] = "fdbugt",
+    [M68kInstruction_FDBUGE] = "fdbuge",
+    [M68kInstruction_FDBULT] = "fdbult",
+    [M68kInstruction_FDBULE] = "fdbule",
+    [M68kInstruction_FDBNE] = "fdbne",
+    [M68kInstruction_FDBT] = "fdbt",
+    [M68kInstruction_FDBSF] = "fdbsf",
+    [M68kInstruction_FDBSEQ] = "fdbseq",
+    [M68kInstruction_FDBGT] = "fdbgt",
+    [M68kInstruction_FDBGE] = "fdbge",
+    [M68kInstruction_FDBLT] = "fdblt",
+    [M68kInstruction_FDBLE] = "fdble",
+    [M68kInstruction_FDBGL] = "fdbgl",
+    [M68kInstruction_FDBGLE] = "fdbgle",
+    [M68kInstruction_FDBNGLE] = "fdbngle",
+    [M68kInstruction_FDBNGL] = "fdbngl",
+    [M68kInstruction_FDBNLE] = "fdbnle",
+    [M68kInstruction_FDBNLT] = "fdbnlt",
+    [M68kInstruction_FDBNGE] = "fdbnge",
+    [M68kInstruction_FDBNGT] = "fdbngt",
+    [M68kInstruction_FDBSNE] = "fdbsne",
+    [M68kInstruction_FDBST] = "fdbst",
+    [M68kInstruction_FDIV] = "fdiv",
+    [M68kInstruction_FSDIV] = "fsdiv",
+    [M68kInstruction_FDDIV] = "fddiv",
+    [M68kInstruction_FETOX] = "fetox",
+    [M68kInstruction_FETOXM1] = "fetoxm1",
+    [M68kInstruction_FGETEXP] = "fgetexp",
+    [M68kInstruction_FGETMAN] = "fgetman",
+    [M68kInstruction_FINT] = "fint",
+    [M68kInstruction_FINTRZ] = "fintrz",
+    [M68kInstruction_FLOG10] = "flog10",
+    [M68kInstruction_FLOG2] = "flog2",
+    [M68kInstruction_FLOGN] = "flogn",
+    [M68kInstruction_FLOGNP1] = "flognp1",
+    [M68kInstruction_FMOD] = "fmod",
+    [M68kInstruction_FMOVE] = "fmove",
+    [M68kInstruction_FSMOVE] = "fsmove",
+    [M68kInstruction_FDMOVE] = "fdmove",
+    [M68kInstruction_FMOVECR] = "fmovecr",
+    [M68kInstruction_FMOVEM] = "fmovem",
+    [M68kInstruction_FMUL] = "fmul",
+    [M68kInstruction_FSMUL] = "fsmul",
+    [M68kInstruction_FDMUL] = "fdmul",
+    [M68kInstruction_FNEG] = "fneg",
+    [M68kInstruction_FSNEG] = "fsneg",
+    [M68kInstruction_FDNEG] = "fdneg",
+    [M68kInstruction_FNOP] = "fnop",
+    [M68kInstruction_FREM] = "frem",
+    [M68kInstruction_FRESTORE] = "frestore",
+    [M68kInstruction_FSAVE] = "fsave",
+    [M68kInstruction_FSCALE] = "fscale",
+    [M68kInstruction_FSGLDIV] = "fsgldiv",
+    [M68kInstruction_FSGLMUL] = "fsglmul",
+    [M68kInstruction_FSIN] = "fsin",
+    [M68kInstruction_FSINCOS] = "fsincos",
+    [M68kInstruction_FSINH] = "fsinh",
+    [M68kInstruction_FSQRT] = "fsqrt",
+    [M68kInstruction_FSSQRT] = "fssqrt",
+    [M68kInstruction_FDSQRT] = "fdsqrt",
+    [M68kInstruction_FSF] = "fsf",
+    [M68kInstruction_FSBEQ] = "fseq",
+    [M68kInstruction_FSOGT] = "fsogt",
+    [M68kInstruction_FSOGE] = "fsoge",
+    [M68kInstruction_FSOLT] = "fsolt",
+    [M68kInstruction_FSOLE] = "fsole",
+    [M68kInstruction_FSOGL] = "fsogl",
+    [M68kInstruction_FSOR] = "fsor",
+    [M68kInstruction_FSUN] = "fsun",
+    [M68kInstruction_FSUEQ] = "fsueq",
+    [M68kInstruction_FSUGT] = "fsugt",
+    [M68kInstruction_FSUGE] = "fsuge",
+    [M68kInstruction_FSULT] = "fsult",
+    [M68kInstruction_FSULE] = "fsule",
+    [M68kInstruction_FSNE] = "fsne",
+    [M68kInstruction_FST] = "fst",
+    [M68kInstruction_FSSF] = "fssf",
+    [M68kInstruction_FSSEQ] = "fsseq",
+    [M68kInstruction_FSGT] = "fsgt",
+    [M68kInstruction_FSGE] = "fsge",
+    [M68kInstruction_FSLT] = "fslt",
+    [M68kInstruction_FSLE] = "fsle",
+    [M68kInstruction_FSGL] = "fsgl",
+    [M68kInstruction_FSGLE] = "fsgle",
+    [M68kInstruction_FSNGLE] = "fsngle",
+    [M68kInstruction_FSNGL] = "fsngl",
+    [M68kInstruction_FSNLE] = "fsnle",
+    [M68kInstruction_FSNLT] = "fsnlt",
+    [M68kInstruction_FSNGE] = "fsnge",
+    [M68kInstruction_FSNGT] = "fsngt",
+    [M68kInstruction_FSSNE] = "fssne",
+    [M68kInstruction_FSST] = "fsst",
+    [M68kInstruction_FSUB] = "fsub",
+    [M68kInstruction_FSSUB] = "fssub",
+    [M68kInstruction_FDSUB] = "fdsub",
+    [M68kInstruction_FTAN] = "ftan",
+    [M68kInstruction_FTANH] = "ftanh",
+    [M68kInstruction_FTENTOX] = "ftentox",
+    [M68kInstruction_FTRAPF] = "ftrapf",
+    [M68kInstruction_FTRAPEQ] = "ftrapeq",
+    [M68kInstruction_FTRAPOGT] = "ftrapogt",
+    [M68kInstruction_FTRAPOGE] = "ftrapoge",
+    [M68kInstruction_FTRAPOLT] = "ftrapolt",
+    [M68kInstruction_FTRAPOLE] = "ftrapole",
+    [M68kInstruction_FTRAPOGL] = "ftrapogl",
+    [M68kInstruction_FTRAPOR] = "ftrapor",
+    [M68kInstruction_FTRAPUN] = "ftrapun",
+    [M68kInstruction_FTRAPUEQ] = "ftrapueq",
+    [M68kInstruction_FTRAPUGT] = "ftrapugt",
+    [M68kInstruction_FTRAPUGE] = "ftrapuge",
+    [M68kInstruction_FTRAPULT] = "ftrapult",
+    [M68kInstruction_FTRAPULE] = "ftrapule",
+    [M68kInstruction_FTRAPNE] = "ftrapne",
+    [M68kInstruction_FTRAPT] = "ftrapt",
+    [M68kInstruction_FTRAPSF] = "ftrapsf",
+    [M68kInstruction_FTRAPSEQ] = "ftrapseq",
+    [M68kInstruction_FTRAPGT] = "ftrapgt",
+    [M68kInstruction_FTRAPGE] = "ftrapge",
+    [M68kInstruction_FTRAPLT] = "ftraplt",
+    [M68kInstruction_FTRAPLE] = "ftraple",
+    [M68kInstruction_FTRAPGL] = "ftrapgl",
+    [M68kInstruction_FTRAPGLE] = "ftrapgle",
+    [M68kInstruction_FTRAPNGLE] = "ftrapngle",
+    [M68kInstruction_FTRAPNGL] = "ftrapngl",
+    [M68kInstruction_FTRAPNLE] = "ftrapnle",
+    [M68kInstruction_FTRAPNLT] = "ftrapnlt",
+    [M68kInstruction_FTRAPNGE] = "ftrapnge",
+    [M68kInstruction_FTRAPNGT] = "ftrapngt",
+    [M68kInstruction_FTRAPSNE] = "ftrapsne",
+    [M68kInstruction_FTRAPST] = "ftrapst",
+    [M68kInstruction_FTST] = "ftst",
+    [M68kInstruction_FTWOTOX] = "ftwotox",
+    [M68kInstruction_HALT] = "halt",
+    [M68kInstruction_ILLEGAL] = "illegal",
+    [M68kInstruction_JMP] = "jmp",
+    [M68kInstruction_JSR] = "jsr",
+    [M68kInstruction_LEA] = "lea",
+    [M68kInstruction_LINK] = "link",
+    [M68kInstruction_LPSTOP] = "lpstop",
+    [M68kInstruction_LSL] = "lsl",
+    [M68kInstruction_LSR] = "lsr",
+    [M68kInstruction_MOVE] = "move",
+    [M68kInstruction_MOVEA] = "movea",
+    [M68kInstruction_MOVEC] = "movec",
+    [M68kInstruction_MOVEM] = "movem",
+    [M68kInstruction_MOVEP] = "movep",
+    [M68kInstruction_MOVEQ] = "moveq",
+    [M68kInstruction_MOVES] = "moves",
+    [M68kInstruction_MOVE16] = "move16",
+    [M68kInstruction_MULS] = "muls",
+    [M68kInstruction_MULU] = "mulu",
+    [M68kInstruction_NBCD] = "nbcd",
+    [M68kInstruction_NEG] = "neg",
+    [M68kInstruction_NEGX] = "negx",
+    [M68kInstruction_NOP] = "nop",
+    [M68kInstruction_NOT] = "not",
+    [M68kInstruction_OR] = "or",
+    [M68kInstruction_ORI] = "ori",
+    [M68kInstruction_PACK] = "pack",
+    [M68kInstruction_PEA] = "pea",
+    [M68kInstruction_PFLUSH] = "pflush",
+    [M68kInstruction_PFLUSHA] = "pflusha",
+    [M68kInstruction_PFLUSHAN] = "pflushan",
+    [M68kInstruction_PFLUSHN] = "pflushn",
+    [M68kInstruction_PLOADR] = "ploadr",
+    [M68kInstruction_PLOADW] = "ploadw",
+    [M68kInstruction_PLPAR] = "plpar",
+    [M68kInstruction_PLPAW] = "plpaw",
+    [M68kInstruction_PMOVE] = "pmove",
+    [M68kInstruction_PMOVEFD] = "pmovefd",
+    [M68kInstruction_PTESTR] = "ptestr",
+    [M68kInstruction_PTESTW] = "ptestw",
+    [M68kInstruction_PULSE] = "pulse",
+    [M68kInstruction_REMS] = "rems",
+    [M68kInstruction_REMU] = "remu",
+    [M68kInstruction_RESET] = "reset",
+    [M68kInstruction_ROL] = "rol",
+    [M68kInstruction_ROR] = "ror",
+    [M68kInstruction_ROXL] = "roxl",
+    [M68kInstruction_ROXR] = "roxr",
+    [M68kInstruction_RTD] = "rtd",
+    [M68kInstruction_RTE] = "rte",
+    [M68kInstruction_RTM] = "rtm",
+    [M68kInstruction_RTR] = "rtr",
+    [M68kInstruction_RTS] = "rts",
+    [M68kInstruction_SBCD] = "sbcd",
+    [M68kInstruction_ST] = "st",
+    [M68kInstruction_SF] = "sf",
+    [M68kInstruction_SHI] = "shi",
+    [M68kInstruction_SLS] = "sls",
+    [M68kInstruction_SCC] = "scc",
+    [M68kInstruction_SHS] = "shs",
+    [M68kInstruction_SCS] = "scs",
+    [M68kInstruction_SLO] = "slo",
+    [M68kInstruction_SNE] = "sne",
+    [M68kInstruction_SEQ] = "seq",
+    [M68kInstruction_SVC] = "svc",
+    [M68kInstruction_SVS] = "svs",
+    [M68kInstruction_SPL] = "spl",
+    [M68kInstruction_SMI] = "smi",
+    [M68kInstruction_SGE] = "sge",
+    [M68kInstruction_SLT] = "slt",
+    [M68kInstruction_SGT] = "sgt",
+    [M68kInstruction_SLE] = "sle",
+    [M68kInstruction_STOP] = "stop",
+    [M68kInstruction_SUB] = "sub",
+    [M68kInstruction_SUBA] = "suba",
+    [M68kInstruction_SUBI] = "subi",
+    [M68kInstruction_SUBQ] = "subq",
+    [M68kInstruction_SUBX] = "subx",
+    [M68kInstruction_SWAP] = "swap",
+    [M68kInstruction_TAS] = "tas",
+    [M68kInstruction_TRAP] = "trap",
+    [M68kInstruction_TRAPV] = "trapv",
+    [M68kInstruction_TRAPT] = "trapt",
+    [M68kInstruction_TRAPF] = "trapf",
+    [M68kInstruction_TRAPHI] = "traphi",
+    [M68kInstruction_TRAPLS] = "trapls",
+    [M68kInstruction_TRAPCC] = "trapcc",
+    [M68kInstruction_TRAPHS] = "traphs",
+    [M68kInstruction_TRAPCS] = "trapcs",
+    [M68kInstruction_TRAPLO] = "traplo",
+    [M68kInstruction_TRAPNE] = "trapne",
+    [M68kInstruction_TRAPEQ] = "trapeq",
+    [M68kInstruction_TRAPVC] = "trapvc",
+    [M68kInstruction_TRAPVS] = "trapvs",
+    [M68kInstruction_TRAPPL] = "trappl",
+    [M68kInstruction_TRAPMI] = "trapmi",
+    [M68kInstruction_TRAPGE] = "trapge",
+    [M68kInstruction_TRAPLT] = "traplt",
+    [M68kInstruction_TRAPGT] = "trapgt",
+    [M68kInstruction_TRAPLE] = "traple",
+    [M68kInstruction_TST] = "tst",
+    [M68kInstruction_UNLK] = "unlk",
+    [M68kInstruction_UNPK] = "unpk",
+};
+
+uint16_t M68kInstructionFromCapstone(unsigned int capstoneID) {
+    return (capstoneID < M68K_INS_ENDING) ? m68kCapstoneInstructions[capstoneID] : M68kInstruction_Invalid;
+}
+
+const char *M68kInstructionName(uint16_t instruction) {
+    return (instruction < M68kInstruction_Count) ? m68kInstructionNames[instruction] : NULL;
+}
+
+// Length decoder
+//
+// The length of an instruction only depends on its first word, except when it uses
+// an indexed addressing mode: the extension word can then be in the full format, followed
+// by base and outer displacements. Capstone decodes this format even in the 68010 mode
+// (CS_MODE_32) the plugin uses. The table gives, for each first word, the
+// length of the instruction with a brief extension word, and where the extension words
+// of the indexed modes are. Some opcodes are only valid when some bits of their second
+// word are cleared: the table also gives the index of this mask. cas2 checks its third
+// word with the same mask.
+//
+// The table is generated from Capstone by Tools/M68kLengthTableGenerator.c, so that it
+// agrees with the decoder used by the CPU context. Identical pages of 64 opcodes, which
+// only differ by their effective address field, are shared.
+
+#define M68K_LENGTH_WORDS_MASK      0x000F  // Length in words, 0 for invalid opcodes
+#define M68K_LENGTH_INDEX_FIRST     0x0010  // The word after the opcode is an index extension word
+#define M68K_LENGTH_INDEX_LAST      0x0020  // The last word is an index extension word
+#define M68K_LENGTH_CHECK_WORD3     0x0040  // The third word is checked like the second one
+#define M68K_LENGTH_WORD2_SHIFT     8       // 1 + index in m68kSecondWordMasks, or 0
+
+#include "M68kLengthTable.h"
+
+static inline uint16_t readBigEndianWord(const uint8_t *bytes) {
+    return (uint16_t) ((bytes[0] << 8) | bytes[1]);
 }
 
-#endif
+// Number of words following a full format extension word.
+static inline size_t fullExtensionExtraWords(uint16_t extension) {
+    if ((extension & 0x0100) == 0) return 0;
+    size_t words = 0;
+    switch (extension & 0x30) {
+        case 0x20: words += 1; break;
+        case 0x30: words += 2; break;
+    }
+    if ((extension & 0x47) < 0x44) {
+        switch (extension & 3) {
+            case 2: words += 1; break;
+            case 3: words += 2; break;
+        }
+    }
+    return words;
+}
+
+// The real length of the instruction, up to 22 bytes, even if Capstone reports 16 bytes at most.
+static size_t m68kInstructionLength(const uint8_t *bytes, size_t available, uint8_t cpuMode) {
+    if (available < 2) return 0;
+    uint16_t opcode = readBigEndianWord(bytes);
+    uint16_t entry = m68kLengthPages[m68kLengthPageIndex[opcode / M68K_LENGTH_PAGE_SIZE]][opcode % M68K_LENGTH_PAGE_SIZE];
+    size_t words = entry & M68K_LENGTH_WORDS_MASK;
+    if (words == 0) return 0;
+
+    uint16_t maskIndex = entry >> M68K_LENGTH_WORD2_SHIFT;
+    if (maskIndex) {
+        uint16_t mask = m68kSecondWordMasks[maskIndex - 1];
+        if (available < 4) return 0;
+        if (readBigEndianWord(bytes + 2) & mask) return 0;
+        if (entry & M68K_LENGTH_CHECK_WORD3) {
+            if (available < 6) return 0;
+            if (readBigEndianWord(bytes + 4) & mask) return 0;
+        }
+    }
+    if (entry & M68K_LENGTH_INDEX_FIRST) {
+        if (available < 4) return 0;
+        words += fullExtensionExtraWords(readBigEndianWord(bytes + 2));
+    }
+    if (entry & M68K_LENGTH_INDEX_LAST) {
+        size_t offset = (words - 1) * 2;
+        if (available < offset + 2) return 0;
+        words += fullExtensionExtraWords(readBigEndianWord(bytes + offset));
+    }
+
+    return (words * 2 <= available) ? words * 2 : 0;
+}
 
 @implementation M68kCPU {
     NSObject<HPHopperServices> *_services;
@@ -151,6 +1058,26 @@ void OSWriteBigInt16(void *address, uintptr_t offset, int16_t data) {
     return reg_class == RegClass_CPUState;
 }
 
+- (NSArray<NSString *> *)registerNamesForClass:(RegClass)reg_class syntaxIndex:(NSUInteger)syntaxIndex {
+    // Built once from the C tables, so that the same strings are always returned.
+    static NSArray<NSString *> *tables[RegClass_M68k_Cnt][2];
+    static dispatch_once_t onceToken;
+    dispatch_once(&onceToken, ^{
+        for (NSUInteger cls=0; cls<RegClass_M68k_Cnt; cls++) {
+            for (NSUInteger variant=0; variant<2; variant++) {
+                NSMutableArray<NSString *> *names = [NSMutableArray array];
+                const char *name;
+                while ((name = M68kRegisterName(names.count, (RegClass) cls, variant)) != NULL) {
+                    [names addObject:@(name)];
+                }
+                tables[cls][variant] = names.count ? [names copy] : nil;
+            }
+        }
+    });
+    if (reg_class >= RegClass_M68k_Cnt) return nil;
+    return tables[reg_class][(syntaxIndex == 1) ? 1 : 0];
+}
+
 - (NSString *)lowercaseStringForRegister:(NSUInteger)reg ofClass:(RegClass)reg_class {
     switch (reg_class) {
         case RegClass_CPUState:
@@ -179,6 +1106,9 @@ void OSWriteBigInt16(void *address, uintptr_t offset, int16_t data) {
 }
 
 - (NSString *)registerIndexToString:(NSUInteger)reg ofClass:(RegClass)reg_class withBitSize:(NSUInteger)size position:(DisasmPosition)position andSyntaxIndex:(NSUInteger)syntaxIndex {
+    NSArray<NSString *> *names = [self registerNamesForClass:reg_class syntaxIndex:syntaxIndex];
+    if (reg < names.count) return names[reg];
+
     NSString *regName = [self lowercaseStringForRegister:reg ofClass:reg_class];
     if (syntaxIndex == 1) regName = [regName uppercaseString];
     return regName;
@@ -192,16 +1122,40 @@ void OSWriteBigInt16(void *address, uintptr_t offset, int16_t data) {
     return index;
 }
 
+- (NOPPattern)nopPatternForMode:(NSUInteger)cpuMode {
+    static const uint8_t nop[] = { 0x4E, 0x71 };
+    return (NOPPattern) { nop, sizeof(nop) };
+}
+
 - (NSData *)nopWithSize:(NSUInteger)size andMode:(NSUInteger)cpuMode forFile:(NSObject<HPDisassembledFile> *)file {
     // Instruction size is always a multiple of 2
     if (size & 1) return nil;
-    NSMutableData *nopArray = [[NSMutableData alloc] initWithCapacity:size];
-    [nopArray setLength:size];
-    uint16_t *ptr = (uint16_t *)[nopArray mutableBytes];
-    for (NSUInteger i=0; i<size; i+=2) {
-        OSWriteBigInt16(ptr, i, 0x4E71);
-    }
-    return [NSData dataWithData:nopArray];
+    NSMutableData *nopArray = [[NSMutableData alloc] initWithLength:size];
+    HPFillWithNOPPattern([nopArray mutableBytes], size, [self nopPatternForMode:cpuMode]);
+    return [nopArray copy];
+}
+
+- (HPInstructionLengthDecoder)instructionLengthDecoder {
+    return m68kInstructionLength;
+}
+
+- (CPUContextHooks)implementedContextHooks {
+    // Every analysis hook of M68kCtx is empty: the branch destinations are direct, and
+    // the stack deltas are computed when the instructions are decoded.
+    return CPUHook_None;
+}
+
+- (NSArray<NSString *> *)instructionMnemonics {
+    static NSArray<NSString *> *mnemonics;
+    static dispatch_once_t onceToken;
+    dispatch_once(&onceToken, ^{
+        NSMutableArray<NSString *> *names = [NSMutableArray arrayWithCapacity:M68kInstruction_Count];
+        for (uint16_t instruction = 0; instruction < M68kInstruction_Count; instruction++) {
+            [names addObject:@(m68kInstructionNames[instruction])];
+        }
+        mnemonics = [names copy];
+    });
+    return mnemonics;
 }
 
 - (BOOL)canAssembleInstructionsForCPUFamily:(NSString *)family andSubFamily:(NSString *)subFamily {
@@ -15,4 +15,19 @@
 
 - (instancetype)initWithCPU:(M68kCPU *)cpu andFile:(NSObject<HPDisassembledFile> *)file;
 
+// Decoded instructions cache.
+// The cache is disabled by default. It keeps the last "capacity" instructions
+// decoded by disassembleSingleInstruction:usingProcessorMode:, and a capacity
+// of 0 disables it again. Changing the capacity empties the cache.
+- (BOOL)setDecodeCacheCapacity:(NSUInteger)capacity;
+- (NSUInteger)decodeCacheCapacity;
+
+- (void)invalidateDecodeCache;
+- (void)invalidateDecodeCacheInRange:(AddressRange)range;
+
+// Statistics, used to tune the capacity.
+- (NSUInteger)decodeCacheHits;
+- (NSUInteger)decodeCacheMisses;
+- (void)resetDecodeCacheStatistics;
+
 @end
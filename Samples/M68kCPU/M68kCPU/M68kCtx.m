@@ -11,28 +11,266 @@
 #import <Hopper/CommonTypes.h>
 #import <Hopper/CPUDefinition.h>
 #import <Hopper/HPDisassembledFile.h>
+#import <Hopper/HPSegmentCursor.h>
 #import <capstone/capstone.h>
 
+// The longest instruction decoded by Capstone: a move with full extension words on both
+// operands. Capstone decodes the full extension format in every CPU mode, including the
+// 68010 mode (CS_MODE_32) the plugin uses.
+#define M68K_MAX_INSTRUCTION_LENGTH     22
+
+// Decoded instructions cache
+//
+// A bounded LRU cache of the instructions decoded at FULL depth, keyed by the
+// address, the CPU mode and the bytes of the instruction. As the bytes are part
+// of the key, a patched instruction is never served from the cache.
+
+#define M68K_CACHE_MAX_INSTRUCTION_LENGTH   24
+#define M68K_CACHE_NONE                     UINT32_MAX
+
+typedef struct {
+    Address virtualAddr;
+    uint32_t prev, next;    // LRU list, most recently used first
+    uint32_t chain;         // Next entry in the same bucket, or in the free list
+    uint8_t mode;
+    uint8_t length;
+    uint8_t bytes[M68K_CACHE_MAX_INSTRUCTION_LENGTH];
+    uintptr_t instructionUserData;
+    DisasmCompactStruct compact;
+    uint64_t userData[DISASM_MAX_OPERANDS][M68K_OP_USER_DATA_COUNT];
+} M68kCacheEntry;
+
+typedef struct {
+    M68kCacheEntry *entries;
+    uint32_t *buckets;
+    uint32_t capacity;
+    uint32_t bucketMask;
+    uint32_t head, tail;
+    uint32_t freeList;
+    NSUInteger hits, misses;
+} M68kDecodeCache;
+
+static inline uint32_t cacheBucket(const M68kDecodeCache *cache, Address address, uint8_t mode) {
+    uint64_t h = (address ^ ((uint64_t) mode << 56)) * 0x9E3779B97F4A7C15llu;
+    return (uint32_t) (h >> 32) & cache->bucketMask;
+}
+
+static void cacheClear(M68kDecodeCache *cache) {
+    for (uint32_t i=0; i<=cache->bucketMask; i++) cache->buckets[i] = M68K_CACHE_NONE;
+    for (uint32_t i=0; i<cache->capacity; i++) {
+        cache->entries[i].length = 0;
+        cache->entries[i].chain = (i + 1 < cache->capacity) ? i + 1 : M68K_CACHE_NONE;
+    }
+    cache->freeList = 0;
+    cache->head = cache->tail = M68K_CACHE_NONE;
+}
+
+static void cacheRelease(M68kDecodeCache *cache) {
+    free(cache->entries);
+    free(cache->buckets);
+    cache->entries = NULL;
+    cache->buckets = NULL;
+    cache->capacity = 0;
+    cache->bucketMask = 0;
+}
+
+static BOOL cacheSetCapacity(M68kDecodeCache *cache, uint32_t capacity) {
+    cacheRelease(cache);
+    if (capacity == 0) return YES;
+
+    uint32_t bucketCount = 1;
+    while (bucketCount < capacity) bucketCount <<= 1;
+
+    cache->entries = malloc(capacity * sizeof(M68kCacheEntry));
+    cache->buckets = malloc(bucketCount * sizeof(uint32_t));
+    if (cache->entries == NULL || cache->buckets == NULL) {
+        cacheRelease(cache);
+        return NO;
+    }
+    cache->capacity = capacity;
+    cache->bucketMask = bucketCount - 1;
+    cacheClear(cache);
+    return YES;
+}
+
+static void cacheUnlink(M68kDecodeCache *cache, uint32_t index) {
+    M68kCacheEntry *entry = cache->entries + index;
+    if (entry->prev != M68K_CACHE_NONE) cache->entries[entry->prev].next = entry->next; else cache->head = entry->next;
+    if (entry->next != M68K_CACHE_NONE) cache->entries[entry->next].prev = entry->prev; else cache->tail = entry->prev;
+}
+
+static void cachePushFront(M68kDecodeCache *cache, uint32_t index) {
+    M68kCacheEntry *entry = cache->entries + index;
+    entry->prev = M68K_CACHE_NONE;
+    entry->next = cache->head;
+    if (cache->head != M68K_CACHE_NONE) cache->entries[cache->head].prev = index; else cache->tail = index;
+    cache->head = index;
+}
+
+static void cacheRemove(M68kDecodeCache *cache, uint32_t index) {
+    M68kCacheEntry *entry = cache->entries + index;
+    uint32_t *link = cache->buckets + cacheBucket(cache, entry->virtualAddr, entry->mode);
+    while (*link != index) link = &cache->entries[*link].chain;
+    *link = entry->chain;
+
+    cacheUnlink(cache, index);
+    entry->length = 0;
+    entry->chain = cache->freeList;
+    cache->freeList = index;
+}
+
+// Fill the DisasmStruct from the cache, if the instruction is known.
+static int cacheLookup(M68kDecodeCache *cache, DisasmStruct *disasm, uint8_t mode) {
+    uint32_t index = cache->buckets[cacheBucket(cache, disasm->virtualAddr, mode)];
+    while (index != M68K_CACHE_NONE) {
+        M68kCacheEntry *entry = cache->entries + index;
+        if (entry->virtualAddr == disasm->virtualAddr && entry->mode == mode &&
+            entry->length <= DisasmBytesAvailable(disasm) && memcmp(entry->bytes, disasm->bytes, entry->length) == 0) {
+            cacheUnlink(cache, index);
+            cachePushFront(cache, index);
+
+            DisasmStructFromCompact(disasm, &entry->compact, NULL);
+            for (int i=0; i<DISASM_MAX_OPERANDS; i++) {
+                memcpy(disasm->operand[i].userData, entry->userData[i], sizeof(entry->userData[i]));
+            }
+            disasm->instruction.userData = entry->instructionUserData;
+            disasm->instruction.mnemonic[0] = 0;
+            cache->hits++;
+            return entry->length;
+        }
+        index = entry->chain;
+    }
+    cache->misses++;
+    return 0;
+}
+
+// Record an instruction decoded at FULL depth, evicting the least recently used one if needed.
+static void cacheInsert(M68kDecodeCache *cache, const DisasmStruct *disasm, uint8_t mode) {
+    uint8_t length = disasm->instruction.length;
+    if (length == 0 || length > M68K_CACHE_MAX_INSTRUCTION_LENGTH) return;
+
+    if (cache->freeList == M68K_CACHE_NONE) cacheRemove(cache, cache->tail);
+    uint32_t index = cache->freeList;
+    M68kCacheEntry *entry = cache->entries + index;
+    cache->freeList = entry->chain;
+
+    entry->virtualAddr = disasm->virtualAddr;
+    entry->mode = mode;
+    entry->length = length;
+    memcpy(entry->bytes, disasm->bytes, length);
+    entry->instructionUserData = disasm->instruction.userData;
+    DisasmCompactFromStruct(&entry->compact, disasm, NULL);
+    for (int i=0; i<DISASM_MAX_OPERANDS; i++) {
+        memcpy(entry->userData[i], disasm->operand[i].userData, sizeof(entry->userData[i]));
+    }
+
+    uint32_t *bucket = cache->buckets + cacheBucket(cache, entry->virtualAddr, mode);
+    entry->chain = *bucket;
+    *bucket = index;
+    cachePushFront(cache, index);
+}
+
 @implementation M68kCtx {
     M68kCPU *_cpu;
     NSObject<HPDisassembledFile> *_file;
     csh _handle;
+    csh _lengthHandle;
+    BOOL _lazyMnemonics;
+    M68kDecodeCache _cache;
+    HPInstructionLengthDecoder _lengthDecoder;
+    SegmentCursor _readCursor;
 }
 
 - (instancetype)initWithCPU:(M68kCPU *)cpu andFile:(NSObject<HPDisassembledFile> *)file {
     if (self = [super init]) {
         _cpu = cpu;
         _file = file;
+        _lengthDecoder = [cpu instructionLengthDecoder];
+        NSObject<HPHopperServices> *services = cpu.hopperServices;
+        _lazyMnemonics = [services respondsToSelector:@selector(supportsLazyMnemonics)] && [services supportsLazyMnemonics];
         if (cs_open(CS_ARCH_M68K, CS_MODE_32, &_handle) != CS_ERR_OK) {
             return nil;
         }
         cs_option(_handle, CS_OPT_DETAIL, CS_OPT_ON);
+
+        // Used when Hopper only needs the instruction length: without the
+        // details, Capstone does not build the operands at all.
+        if (cs_open(CS_ARCH_M68K, CS_MODE_32, &_lengthHandle) != CS_ERR_OK) {
+            cs_close(&_handle);
+            return nil;
+        }
     }
     return self;
 }
 
 - (void)dealloc {
     cs_close(&_handle);
+    cs_close(&_lengthHandle);
+    cacheRelease(&_cache);
+}
+
+// Decoded instructions cache
+
+- (BOOL)setDecodeCacheCapacity:(NSUInteger)capacity {
+    if (capacity > UINT32_MAX - 1) return NO;
+    _cache.hits = _cache.misses = 0;
+    return cacheSetCapacity(&_cache, (uint32_t) capacity);
+}
+
+- (NSUInteger)decodeCacheCapacity {
+    return _cache.capacity;
+}
+
+- (void)invalidateDecodeCache {
+    if (_cache.capacity) cacheClear(&_cache);
+}
+
+- (void)invalidateDecodeCacheInRange:(AddressRange)range {
+    for (uint32_t i=0; i<_cache.capacity; i++) {
+        M68kCacheEntry *entry = _cache.entries + i;
+        if (entry->length == 0) continue;
+        if (entry->virtualAddr < range.from + range.len && range.from < entry->virtualAddr + entry->length) {
+            cacheRemove(&_cache, i);
+        }
+    }
+}
+
+- (NSUInteger)decodeCacheHits {
+    return _cache.hits;
+}
+
+- (NSUInteger)decodeCacheMisses {
+    return _cache.misses;
+}
+
+- (void)resetDecodeCacheStatistics {
+    _cache.hits = _cache.misses = 0;
+}
+
+- (NSObject<CPUContext> *)cloneForConcurrentAnalysis {
+    // Capstone builds its M68k opcode table lazily, in a global variable, on
+    // the first decoding. Make sure this is done before the clones are used
+    // on different threads.
+    static const uint8_t nop[] = { 0x4e, 0x71 };
+    cs_insn *insn;
+    size_t count = cs_disasm(_handle, nop, sizeof(nop), 0, 1, &insn);
+    if (count) cs_free(insn, count);
+
+    // Each clone has its own Capstone handles and decode cache.
+    M68kCtx *clone = [[M68kCtx alloc] initWithCPU:_cpu andFile:_file];
+    if (clone && _cache.capacity) {
+        [clone setDecodeCacheCapacity:_cache.capacity];
+    }
+    return clone;
+}
+
+- (void)bytesChangedInRange:(AddressRange)range {
+    // The bytes are part of the cache key, so a stale entry would never be
+    // used again. They are removed to leave room for the new instructions.
+    [self invalidateDecodeCacheInRange:range];
+
+    // The bytes pinned by the read cursor may have moved.
+    memset(&_readCursor, 0, sizeof(_readCursor));
 }
 
 - (NSObject<CPUDefinition> *)cpuDefinition {
@@ -40,7 +278,7 @@
 }
 
 - (void)initDisasmStructure:(DisasmStruct *)disasm withSyntaxIndex:(NSUInteger)syntaxIndex {
-    bzero(disasm, sizeof(DisasmStruct));
+    DisasmStructInit(disasm);
 }
 
 // Analysis
@@ -62,29 +300,119 @@
     return ((address & ~1) + 2);
 }
 
+static inline uint16_t readBigEndianWord(const uint8_t *bytes) {
+    return (uint16_t) ((bytes[0] << 8) | bytes[1]);
+}
+
 - (int)isNopAt:(Address)address {
-    uint16_t word = [_file readUInt16AtVirtualAddress:address];
-    return (word == 0x4e71) ? 2 : 0;
+    ByteSpan span = [_file bytesInRange:(AddressRange) { address, 2 }];
+    if (span.length < 2) return 0;
+    return (readBigEndianWord(span.bytes) == 0x4e71) ? 2 : 0;
 }
 
 - (BOOL)hasProcedurePrologAt:(Address)address {
     // procedures usually begins with a "movem.l xxx, -(a7)" or "link" instruction
-    uint16_t word = [_file readUInt16AtVirtualAddress:address];
+    ByteSpan span = [_file bytesInRange:(AddressRange) { address, 2 }];
+    if (span.length < 2) return NO;
+    uint16_t word = readBigEndianWord(span.bytes);
     return (word == 0x48e7) || ((word & 0xFFF8) == 0x4e50);
 }
 
 - (NSUInteger)detectedPaddingLengthAt:(Address)address {
-    if (![_file hasMappedDataAt:address]) {
-        return 0;
+    // The mapped bytes of a segment are scanned in place. The run may continue
+    // in the next segment, when it reaches the end of the current one.
+    SegmentCursor cursor;
+    Address current = address;
+    while (HPSegmentCursorInit(&cursor, _file, current, CPUEndianess_Big) && HPSegmentCursorContains(&cursor, current, 2)) {
+        const uint8_t *bytes = cursor.bytes + (current - cursor.start);
+        size_t length = (size_t) (cursor.end - current);
+        size_t offset = 0;
+        while (offset + 2 <= length && (bytes[offset] | bytes[offset + 1]) == 0) offset += 2;
+        current += offset;
+        if (offset + 2 <= length) break;
     }
+    return (NSUInteger) (current - address);
+}
 
-    NSUInteger len = 0;
-    while ([_file hasMappedDataAt:address] && [_file readUInt16AtVirtualAddress:address] == 0) {
-        address += 2;
-        len += 2;
+// Call the block for each part of the range which is backed by mapped data, in address order.
+- (void)enumerateMappedBytesInRange:(AddressRange)range usingBlock:(void (^)(Address start, const uint8_t *bytes, size_t length))block {
+    Address rangeEnd = range.from + range.len;
+    NSArray<NSObject<HPSegment> *> *segments = [[_file segments] sortedArrayUsingComparator:^NSComparisonResult(NSObject<HPSegment> *a, NSObject<HPSegment> *b) {
+        if (a.startAddress == b.startAddress) return NSOrderedSame;
+        return (a.startAddress < b.startAddress) ? NSOrderedAscending : NSOrderedDescending;
+    }];
+    for (NSObject<HPSegment> *segment in segments) {
+        NSData *data = [segment mappedData];
+        if (data == nil) continue;
+
+        Address segStart = [segment startAddress];
+        Address start = MAX(range.from, segStart);
+        Address end = MIN(rangeEnd, segStart + data.length);
+        if (start >= end) continue;
+
+        block(start, (const uint8_t *) data.bytes + (start - segStart), (size_t) (end - start));
     }
+}
 
-    return len;
+- (NSArray<NSNumber *> *)procedurePrologCandidatesInRange:(AddressRange)range {
+    NSMutableArray<NSNumber *> *candidates = [NSMutableArray array];
+    [self enumerateMappedBytesInRange:range usingBlock:^(Address start, const uint8_t *bytes, size_t length) {
+        // Same test as hasProcedurePrologAt:, on every word of the range.
+        size_t offset = start & 1;
+        for ( ; offset + 2 <= length; offset += 2) {
+            uint16_t word = readBigEndianWord(bytes + offset);
+            if ((word == 0x48e7) || ((word & 0xFFF8) == 0x4e50)) {
+                [candidates addObject:@(start + offset)];
+            }
+        }
+    }];
+    return candidates;
+}
+
+- (NSArray<NSValue *> *)paddingRunsInRange:(AddressRange)range {
+    NSMutableArray<NSValue *> *runs = [NSMutableArray array];
+    __block Address covered = 0;
+    [self enumerateMappedBytesInRange:range usingBlock:^(Address start, const uint8_t *bytes, size_t length) {
+        // Skip the bytes of the previous run, when it continued in this segment.
+        size_t offset = start & 1;
+        if (covered > start) offset = MAX(offset, (size_t) (covered - start));
+        while (offset + 2 <= length) {
+            if (bytes[offset] | bytes[offset + 1]) {
+                offset += 2;
+                continue;
+            }
+
+            // Extend the run of zero words, 8 bytes at a time when possible.
+            size_t runStart = offset;
+            uint64_t chunk;
+            while (offset + 8 <= length && (memcpy(&chunk, bytes + offset, 8), chunk == 0)) offset += 8;
+            while (offset + 2 <= length && (bytes[offset] | bytes[offset + 1]) == 0) offset += 2;
+
+            // A run which reaches the end of the mapped bytes may continue in the next segment.
+            AddressRange run = { start + runStart, offset - runStart };
+            if (offset + 2 > length) run.len = [self detectedPaddingLengthAt:run.from];
+            covered = run.from + run.len;
+            [runs addObject:[NSValue valueWithBytes:&run objCType:@encode(AddressRange)]];
+        }
+    }];
+    return runs;
+}
+
+- (NSArray<NSValue *> *)estimateCPUModesForRange:(AddressRange)range {
+    // There is a single CPU mode.
+    NSMutableArray<NSValue *> *runs = [NSMutableArray array];
+    __block CPUModeRun run = { { 0, 0 }, 0 };
+    [self enumerateMappedBytesInRange:range usingBlock:^(Address start, const uint8_t *bytes, size_t length) {
+        if (run.range.len && run.range.from + run.range.len == start) {
+            run.range.len += length;
+            return;
+        }
+        if (run.range.len) [runs addObject:[NSValue valueWithBytes:&run objCType:@encode(CPUModeRun)]];
+        run.range.from = start;
+        run.range.len = length;
+    }];
+    if (run.range.len) [runs addObject:[NSValue valueWithBytes:&run objCType:@encode(CPUModeRun)]];
+    return runs;
 }
 
 - (void)analysisBeginsAt:(Address)entryPoint {
@@ -133,6 +461,10 @@ uint16_t memory_read_callback(uint32_t address, void* private) {
 }
 
 - (uint16_t)readWordAt:(uint32_t)address {
+    // The segment is only resolved again when the address leaves the pinned one.
+    uint16_t word;
+    if (HPSegmentCursorReadUInt16(&_readCursor, address, &word)) return word;
+    if (HPSegmentCursorInit(&_readCursor, _file, address, CPUEndianess_Big) && HPSegmentCursorReadUInt16(&_readCursor, address, &word)) return word;
     return [_file readUInt16AtVirtualAddress:address];
 }
 
@@ -214,21 +546,271 @@ static inline RegClass capstoneRegisterToRegClass(m68k_reg reg) {
     return (RegClass) -1;
 }
 
-- (int)disassembleSingleInstruction:(DisasmStruct *)disasm usingProcessorMode:(NSUInteger)mode {
-    if (disasm->bytes == NULL) return DISASM_UNKNOWN_OPCODE;
+static DisasmInstructionClass instructionClassForInstruction(const cs_insn *insn, DisasmBranchType branchType, BOOL isJump) {
+    switch (branchType) {
+        case DISASM_BRANCH_NONE: break;
+        case DISASM_BRANCH_CALL: return DISASM_INST_CLASS_CALL;
+        case DISASM_BRANCH_RET: return DISASM_INST_CLASS_RETURN;
+        default: return DISASM_INST_CLASS_BRANCH;
+    }
+    if (isJump) return DISASM_INST_CLASS_BRANCH;
+
+    switch (insn->id) {
+        case M68K_INS_NOP:
+        case M68K_INS_FNOP:
+            return DISASM_INST_CLASS_NOP;
+
+        case M68K_INS_EXG: case M68K_INS_LEA: case M68K_INS_LINK: case M68K_INS_MOVE:
+        case M68K_INS_MOVEA: case M68K_INS_MOVEM: case M68K_INS_MOVEP: case M68K_INS_MOVEQ:
+        case M68K_INS_MOVE16: case M68K_INS_PEA: case M68K_INS_SWAP: case M68K_INS_UNLK:
+        case M68K_INS_CLR: case M68K_INS_PACK: case M68K_INS_UNPK:
+            return DISASM_INST_CLASS_DATA_TRANSFER;
+
+        case M68K_INS_ABCD: case M68K_INS_ADD: case M68K_INS_ADDA: case M68K_INS_ADDI:
+        case M68K_INS_ADDQ: case M68K_INS_ADDX: case M68K_INS_DIVS: case M68K_INS_DIVSL:
+        case M68K_INS_DIVU: case M68K_INS_DIVUL: case M68K_INS_EXT: case M68K_INS_EXTB:
+        case M68K_INS_MULS: case M68K_INS_MULU: case M68K_INS_NBCD: case M68K_INS_NEG:
+        case M68K_INS_NEGX: case M68K_INS_REMS: case M68K_INS_REMU: case M68K_INS_SBCD:
+        case M68K_INS_SUB: case M68K_INS_SUBA: case M68K_INS_SUBI: case M68K_INS_SUBQ:
+        case M68K_INS_SUBX:
+            return DISASM_INST_CLASS_ARITHMETIC;
+
+        case M68K_INS_AND: case M68K_INS_ANDI: case M68K_INS_ASL: case M68K_INS_ASR:
+        case M68K_INS_BCHG: case M68K_INS_BCLR: case M68K_INS_BSET: case M68K_INS_BFCHG:
+        case M68K_INS_BFCLR: case M68K_INS_BFEXTS: case M68K_INS_BFEXTU: case M68K_INS_BFFFO:
+        case M68K_INS_BFINS: case M68K_INS_BFSET: case M68K_INS_EOR: case M68K_INS_EORI:
+        case M68K_INS_LSL: case M68K_INS_LSR: case M68K_INS_NOT: case M68K_INS_OR:
+        case M68K_INS_ORI: case M68K_INS_ROL: case M68K_INS_ROR: case M68K_INS_ROXL:
+        case M68K_INS_ROXR:
+            return DISASM_INST_CLASS_LOGICAL;
+
+        case M68K_INS_BTST: case M68K_INS_BFTST: case M68K_INS_CAS: case M68K_INS_CAS2:
+        case M68K_INS_CHK: case M68K_INS_CHK2: case M68K_INS_CMP: case M68K_INS_CMPA:
+        case M68K_INS_CMPI: case M68K_INS_CMPM: case M68K_INS_CMP2: case M68K_INS_TAS:
+        case M68K_INS_TST:
+            return DISASM_INST_CLASS_COMPARE;
+
+        default:
+            break;
+    }
 
-    cs_insn *insn;
-    size_t count = cs_disasm(_handle, disasm->bytes, 32, disasm->virtualAddr, 1, &insn);
-    if (count == 0) return DISASM_UNKNOWN_OPCODE;
+    if (insn->id >= M68K_INS_FABS && insn->id <= M68K_INS_FTWOTOX) return DISASM_INST_CLASS_FLOAT;
+    if (insn->id >= M68K_INS_ST && insn->id <= M68K_INS_SLE) return DISASM_INST_CLASS_LOGICAL;
+
+    return DISASM_INST_CLASS_SYSTEM;
+}
+
+// The operation size is kept in the userData field of the instruction, so that
+// the mnemonic can be rebuilt from the instruction identifier when printed.
+static inline uintptr_t packOperationSize(const cs_insn *insn) {
+    const m68k_op_size *opSize = &insn->detail->m68k.op_size;
+    return ((uintptr_t) opSize->type << 8) | (uintptr_t) opSize->cpu_size;
+}
+
+static const char *operationSizeSuffix(uintptr_t packedSize) {
+    unsigned int size = (unsigned int) (packedSize & 0xFF);
+    switch ((m68k_size_type) (packedSize >> 8)) {
+        case M68K_SIZE_TYPE_CPU:
+            switch (size) {
+                case M68K_CPU_SIZE_BYTE: return ".b";
+                case M68K_CPU_SIZE_WORD: return ".w";
+                case M68K_CPU_SIZE_LONG: return ".l";
+            }
+            break;
+        case M68K_SIZE_TYPE_FPU:
+            switch (size) {
+                case M68K_FPU_SIZE_SINGLE: return ".s";
+                case M68K_FPU_SIZE_DOUBLE: return ".d";
+                case M68K_FPU_SIZE_EXTENDED: return ".x";
+            }
+            break;
+        default:
+            break;
+    }
+    return "";
+}
+
+// Build the mnemonic from the instruction identifier and the operation size kept in userData.
+static void buildMnemonic(DisasmStruct *disasm) {
+    snprintf(disasm->instruction.mnemonic, sizeof(disasm->instruction.mnemonic), "%s%s",
+             M68kInstructionName(disasm->instruction.instructionID),
+             operationSizeSuffix(disasm->instruction.userData));
+}
+
+// PC relative operands give the instruction its addressValue, even at the FLOW depth.
+static BOOL hasPCRelativeOperand(const cs_insn *insn) {
+    for (int i=0; i<insn->detail->m68k.op_count; i++) {
+        const cs_m68k_op *op = insn->detail->m68k.operands + i;
+        if (op->type == M68K_OP_MEM && (op->address_mode == M68K_AM_PCI_DISP || op->address_mode == M68K_AM_PCI_INDEX_8_BIT_DISP)) return YES;
+    }
+    return NO;
+}
+
+static inline BOOL isStackPointer(const cs_m68k_op *op) {
+    return op->type == M68K_OP_REG && op->reg == M68K_REG_A7;
+}
+
+static inline BOOL isFPControlRegister(const cs_m68k_op *op) {
+    return op->type == M68K_OP_REG && (op->reg == M68K_REG_FPCR || op->reg == M68K_REG_FPSR || op->reg == M68K_REG_FPIAR);
+}
+
+static inline BOOL usesStackPointerAs(const cs_m68k_op *op, m68k_address_mode mode) {
+    return op->type == M68K_OP_MEM && op->address_mode == mode && op->reg == M68K_REG_A7;
+}
 
-    disasm->instruction.branchType = DISASM_BRANCH_NONE;
-    disasm->instruction.addressValue = 0;
-    disasm->instruction.pcRegisterValue = disasm->virtualAddr + insn->size;
+// Effect of the instruction on a7.
+// Pushes and pops through -(a7) and (a7)+ move a7 by the operation size, and at
+// least by 2 bytes for a byte, as a7 stays word aligned.
+static DisasmStackDeltaKind stackDeltaForInstruction(const cs_insn *insn, int32_t *delta) {
+    const cs_m68k *m68k = &insn->detail->m68k;
+    const cs_m68k_op *ops = m68k->operands;
+    int32_t size = (int32_t) m68k->op_size.cpu_size;
+    if (m68k->op_size.type == M68K_SIZE_TYPE_FPU) size = (int32_t) m68k->op_size.fpu_size;
+    if (size == 1) size = 2;
+
+    *delta = 0;
+    switch (insn->id) {
+        case M68K_INS_LINK:
+            // The frame pointer is pushed, and the displacement is added to a7.
+            *delta = -4 + ((size == 2) ? (int16_t) ops[1].imm : (int32_t) ops[1].imm);
+            return DISASM_STACK_DELTA_KNOWN;
+
+        case M68K_INS_UNLK:
+            return DISASM_STACK_DELTA_FROM_FRAME;
+
+        case M68K_INS_PEA:
+            *delta = -4;
+            return DISASM_STACK_DELTA_KNOWN;
+
+        case M68K_INS_JSR:
+        case M68K_INS_BSR:
+            // The return address is popped by the callee.
+            return DISASM_STACK_DELTA_KNOWN;
+
+        case M68K_INS_RTS:
+            *delta = 4;
+            return DISASM_STACK_DELTA_KNOWN;
+
+        case M68K_INS_RTD:
+            *delta = 4 + (int16_t) ops[0].imm;
+            return DISASM_STACK_DELTA_KNOWN;
+
+        case M68K_INS_RTE:
+        case M68K_INS_RTR:
+            return DISASM_STACK_DELTA_UNKNOWN;
+
+        case M68K_INS_MOVEM:
+            if (m68k->op_count == 2) {
+                int32_t count = __builtin_popcount(ops[0].type == M68K_OP_REG_BITS ? ops[0].register_bits : ops[1].register_bits);
+                if (usesStackPointerAs(ops + 1, M68K_AM_REGI_ADDR_PRE_DEC)) *delta = -count * size;
+                if (usesStackPointerAs(ops + 0, M68K_AM_REGI_ADDR_POST_INC)) *delta = count * size;
+            }
+            return DISASM_STACK_DELTA_KNOWN;
+
+        case M68K_INS_FMOVEM:
+            // The floating point registers are moved in the 96 bits extended format.
+            if (m68k->op_count == 2) {
+                const cs_m68k_op *list = (ops[0].type == M68K_OP_MEM) ? ops + 1 : ops + 0;
+                BOOL push = usesStackPointerAs(ops + 1, M68K_AM_REGI_ADDR_PRE_DEC);
+                BOOL pop = usesStackPointerAs(ops + 0, M68K_AM_REGI_ADDR_POST_INC);
+                if (list->type != M68K_OP_REG_BITS) return (push || pop) ? DISASM_STACK_DELTA_UNKNOWN : DISASM_STACK_DELTA_KNOWN;
+                int32_t count = __builtin_popcount(list->register_bits);
+                if (push) *delta = -count * 12;
+                if (pop) *delta = count * 12;
+            }
+            return DISASM_STACK_DELTA_KNOWN;
+
+        case M68K_INS_FMOVE:
+            // Capstone decodes a move of a list of control registers as a move of the first
+            // one: the list is read from the extension word, and each register is 32 bits.
+            if (m68k->op_count == 2 && (isFPControlRegister(ops + 0) || isFPControlRegister(ops + 1))) {
+                int32_t count = __builtin_popcount((insn->bytes[2] >> 2) & 7);
+                if (usesStackPointerAs(ops + 1, M68K_AM_REGI_ADDR_PRE_DEC)) *delta = -count * 4;
+                if (usesStackPointerAs(ops + 0, M68K_AM_REGI_ADDR_POST_INC)) *delta = count * 4;
+                return DISASM_STACK_DELTA_KNOWN;
+            }
+            break;
+
+        case M68K_INS_ADDQ:
+        case M68K_INS_ADDA:
+        case M68K_INS_SUBQ:
+        case M68K_INS_SUBA:
+            if (m68k->op_count == 2 && isStackPointer(ops + 1)) {
+                if (ops[0].type != M68K_OP_IMM) return DISASM_STACK_DELTA_UNKNOWN;
+                int32_t value = (size == 2) ? (int16_t) ops[0].imm : (int32_t) ops[0].imm;
+                *delta = (insn->id == M68K_INS_ADDQ || insn->id == M68K_INS_ADDA) ? value : -value;
+                return DISASM_STACK_DELTA_KNOWN;
+            }
+            break;
+
+        case M68K_INS_LEA:
+            if (m68k->op_count == 2 && isStackPointer(ops + 1)) {
+                const cs_m68k_op *ea = ops + 0;
+                if (usesStackPointerAs(ea, M68K_AM_REGI_ADDR)) return DISASM_STACK_DELTA_KNOWN;
+                if (ea->type == M68K_OP_MEM && ea->address_mode == M68K_AM_REGI_ADDR_DISP && ea->mem.base_reg == M68K_REG_A7) {
+                    *delta = (int16_t) ea->mem.disp;
+                    return DISASM_STACK_DELTA_KNOWN;
+                }
+                return DISASM_STACK_DELTA_UNKNOWN;
+            }
+            return DISASM_STACK_DELTA_KNOWN;
+
+        case M68K_INS_EXG:
+            if (isStackPointer(ops + 0) || isStackPointer(ops + 1)) return DISASM_STACK_DELTA_UNKNOWN;
+            return DISASM_STACK_DELTA_KNOWN;
+
+        // These instructions only read their last operand.
+        case M68K_INS_CMP: case M68K_INS_CMPA: case M68K_INS_CMPI: case M68K_INS_TST:
+        case M68K_INS_CHK: case M68K_INS_CHK2: case M68K_INS_CMP2: case M68K_INS_BTST:
+            break;
+
+        default:
+            // Any other write of a7 is not tracked.
+            if (m68k->op_count > 0 && isStackPointer(ops + m68k->op_count - 1)) return DISASM_STACK_DELTA_UNKNOWN;
+            break;
+    }
+
+    for (int i=0; i<m68k->op_count; i++) {
+        if (usesStackPointerAs(ops + i, M68K_AM_REGI_ADDR_PRE_DEC)) *delta -= size;
+        if (usesStackPointerAs(ops + i, M68K_AM_REGI_ADDR_POST_INC)) *delta += size;
+    }
+
+    return DISASM_STACK_DELTA_KNOWN;
+}
+
+// Same answers as the instruction… predicates of the context, so that Hopper doesn't have to ask.
+static DisasmInstrPredicates predicatesForInstruction(const cs_insn *insn) {
+    DisasmInstrPredicates predicates;
+    bzero(&predicates, sizeof(predicates));
+    predicates.authoritative = 1;
+    predicates.onlyLoadsAddress = (insn->id == M68K_INS_LEA);
+    predicates.canBeUsedToExtractDirectMemoryReferences = 1;
+    return predicates;
+}
+
+// Translate a Capstone instruction into the compact Hopper representation.
+// The operands user data is written through the "userData" pointers, one per operand,
+// so that it lands directly in its final location (DisasmStruct or side table).
+// This is a plain C function so that the batch decoder does not pay for a message per instruction.
+// With DISASM_DECODE_DEPTH_FLOW, only the operands of branch instructions are translated.
+static int fillCompactWithInstruction(csh handle, const cs_insn *insn, DisasmCompactStruct *compact, uint64_t * const userData[DISASM_MAX_OPERANDS], DisasmDecodeDepth depth) {
+    bzero(compact->operand, sizeof(compact->operand));
+    compact->length = (uint8_t) insn->size;
+    compact->branchType = DISASM_BRANCH_NONE;
+    compact->addressValue = 0;
+    compact->pcRegisterValue = compact->virtualAddr + insn->size;
+    compact->instructionID = M68kInstructionFromCapstone(insn->id);
+
+    BOOL isJump = cs_insn_group(handle, insn, M68K_GRP_JUMP);
+    int op_count = insn->detail->m68k.op_count;
+    if (depth == DISASM_DECODE_DEPTH_FLOW && !isJump && !hasPCRelativeOperand(insn)) {
+        op_count = 0;
+    }
 
     int op_index;
-    for (op_index=0; op_index<insn->detail->m68k.op_count; op_index++) {
+    for (op_index=0; op_index<op_count; op_index++) {
         cs_m68k_op *op = insn->detail->m68k.operands + op_index;
-        DisasmOperand *hop_op = disasm->operand + op_index;
+        DisasmCompactOperand *hop_op = compact->operand + op_index;
 
         switch (op->type) {
             case M68K_OP_IMM:
@@ -240,7 +822,7 @@ static inline RegClass capstoneRegisterToRegClass(m68k_reg reg) {
                 hop_op->type = DISASM_OPERAND_REGISTER_TYPE;
                 hop_op->type |= DISASM_BUILD_REGISTER_CLS_MASK(capstoneRegisterToRegClass(op->reg));
                 hop_op->type |= DISASM_BUILD_REGISTER_INDEX_MASK(capstoneRegisterToRegIndex(op->reg));
-                hop_op->userData[DISASM_M68K_OP_USER_REGLIST] = 0;
+                userData[op_index][DISASM_M68K_OP_USER_REGLIST] = 0;
                 break;
 
             case M68K_OP_REG_BITS:
@@ -263,7 +845,7 @@ static inline RegClass capstoneRegisterToRegClass(m68k_reg reg) {
                     }
                 }
 
-                hop_op->userData[DISASM_M68K_OP_USER_REGLIST] = op->register_bits;
+                userData[op_index][DISASM_M68K_OP_USER_REGLIST] = op->register_bits;
 
                 break;
 
@@ -316,7 +898,7 @@ static inline RegClass capstoneRegisterToRegClass(m68k_reg reg) {
                     hop_op->type |= DISASM_BUILD_REGISTER_CLS_MASK(idxCls);
                     hop_op->type |= mask;
                     hop_op->memory.indexRegistersMask = mask;
-                    hop_op->userData[DISASM_M68K_OP_USER_INDEX_REG_CLASS] = idxCls;
+                    userData[op_index][DISASM_M68K_OP_USER_INDEX_REG_CLASS] = idxCls;
 
                     hop_op->memory.scale = op->mem.scale;
                 }
@@ -331,16 +913,16 @@ static inline RegClass capstoneRegisterToRegClass(m68k_reg reg) {
                 }
 
                 if (baseIsPC && hasDisp && !hasIndex) {
-                    disasm->instruction.pcRegisterValue -= 2;
-                    disasm->instruction.addressValue = disasm->instruction.pcRegisterValue + hop_op->memory.displacement;
+                    compact->pcRegisterValue -= 2;
+                    compact->addressValue = compact->pcRegisterValue + hop_op->memory.displacement;
                 }
                 
                 if (!registerIndirect && !hasIndex && !baseIsPC) {
                     hop_op->immediateValue = op->imm;
                 }
 
-                if (postIncr) hop_op->userData[DISASM_M68K_OP_USER_INCREMENT] = INCR_Postincrement;
-                if (preDecr) hop_op->userData[DISASM_M68K_OP_USER_INCREMENT] = INCR_Predecrement;
+                if (postIncr) userData[op_index][DISASM_M68K_OP_USER_INCREMENT] = INCR_Postincrement;
+                if (preDecr) userData[op_index][DISASM_M68K_OP_USER_INCREMENT] = INCR_Predecrement;
 
                 hop_op->size = size;
 
@@ -353,12 +935,11 @@ static inline RegClass capstoneRegisterToRegClass(m68k_reg reg) {
         }
 
     }
+    compact->operandCount = (uint8_t) op_count;
     for ( ; op_index < DISASM_MAX_OPERANDS; op_index++) {
-        disasm->operand[op_index].type = DISASM_OPERAND_NO_OPERAND;
+        compact->operand[op_index].type = DISASM_OPERAND_NO_OPERAND;
     }
 
-    strcpy(disasm->instruction.mnemonic, insn->mnemonic);
-
     // In this early version, only branch instructions are analyzed in order to correctly
     // construct basic blocks of procedures.
     //
@@ -367,17 +948,17 @@ static inline RegClass capstoneRegisterToRegClass(m68k_reg reg) {
     // You should also fill the "operand" description for every other instruction to take
     // advantage of the various analysis of Hopper.
 
-    if (cs_insn_group(_handle, insn, M68K_GRP_JUMP)) {
+    if (isJump) {
         if (insn->detail->m68k.op_count > 0) {
             int lastOperandIndex = insn->detail->m68k.op_count - 1;
             cs_m68k_op *lastOperand = &insn->detail->m68k.operands[lastOperandIndex];
             if (lastOperand->type == M68K_OP_IMM) {
-                disasm->instruction.addressValue = lastOperand->imm;
-                disasm->operand[lastOperandIndex].type = DISASM_OPERAND_CONSTANT_TYPE | DISASM_OPERAND_RELATIVE;
-                disasm->operand[lastOperandIndex].memory.displacement = disasm->instruction.addressValue;
+                compact->addressValue = lastOperand->imm;
+                compact->operand[lastOperandIndex].type = DISASM_OPERAND_CONSTANT_TYPE | DISASM_OPERAND_RELATIVE;
+                compact->operand[lastOperandIndex].memory.displacement = compact->addressValue;
             }
             if (insn->detail->m68k.operands[lastOperandIndex].type == M68K_OP_MEM) {
-                disasm->instruction.addressValue = lastOperand->imm;
+                compact->addressValue = lastOperand->imm;
                 switch (lastOperand->address_mode) {
                     case M68K_AM_NONE: break;
                     case M68K_AM_REG_DIRECT_DATA: break;
@@ -391,142 +972,291 @@ static inline RegClass capstoneRegisterToRegClass(m68k_reg reg) {
                     case M68K_AM_MEMI_POST_INDEX: break;
                     case M68K_AM_MEMI_PRE_INDEX: break;
                     case M68K_AM_PCI_DISP:
-                        disasm->operand[lastOperandIndex].type = DISASM_OPERAND_CONSTANT_TYPE | DISASM_OPERAND_RELATIVE;
-                        disasm->instruction.addressValue = disasm->virtualAddr + insn->size + lastOperand->mem.disp;
+                        compact->operand[lastOperandIndex].type = DISASM_OPERAND_CONSTANT_TYPE | DISASM_OPERAND_RELATIVE;
+                        compact->addressValue = compact->virtualAddr + insn->size + lastOperand->mem.disp;
                         break;
                     case M68K_AM_PCI_INDEX_8_BIT_DISP: break;
                     case M68K_AM_PCI_INDEX_BASE_DISP: break;
                     case M68K_AM_PC_MEMI_POST_INDEX: break;
                     case M68K_AM_PC_MEMI_PRE_INDEX: break;
                     case M68K_AM_ABSOLUTE_DATA_SHORT:
-                        disasm->operand[lastOperandIndex].type = DISASM_OPERAND_CONSTANT_TYPE | DISASM_OPERAND_ABSOLUTE;
-                        disasm->instruction.addressValue = lastOperand->imm;
+                        compact->operand[lastOperandIndex].type = DISASM_OPERAND_CONSTANT_TYPE | DISASM_OPERAND_ABSOLUTE;
+                        compact->addressValue = lastOperand->imm;
                         break;
                     case M68K_AM_ABSOLUTE_DATA_LONG:
-                        disasm->operand[lastOperandIndex].type = DISASM_OPERAND_CONSTANT_TYPE | DISASM_OPERAND_ABSOLUTE;
-                        disasm->instruction.addressValue = lastOperand->imm;
+                        compact->operand[lastOperandIndex].type = DISASM_OPERAND_CONSTANT_TYPE | DISASM_OPERAND_ABSOLUTE;
+                        compact->addressValue = lastOperand->imm;
                         break;
                     case M68K_AM_IMMIDIATE:
-                        disasm->operand[lastOperandIndex].type = DISASM_OPERAND_CONSTANT_TYPE | DISASM_OPERAND_ABSOLUTE;
-                        disasm->instruction.addressValue = lastOperand->imm;
+                        compact->operand[lastOperandIndex].type = DISASM_OPERAND_CONSTANT_TYPE | DISASM_OPERAND_ABSOLUTE;
+                        compact->addressValue = lastOperand->imm;
                         break;
                 }
             }
-            disasm->operand[lastOperandIndex].isBranchDestination = 1;
-            if (disasm->instruction.addressValue) disasm->operand[lastOperandIndex].immediateValue = disasm->instruction.addressValue;
+            compact->operand[lastOperandIndex].isBranchDestination = 1;
+            if (compact->addressValue) compact->operand[lastOperandIndex].immediateValue = compact->addressValue;
         }
 
         switch(insn->id) {
             case M68K_INS_JMP:
-                disasm->instruction.branchType = DISASM_BRANCH_JMP;
+                compact->branchType = DISASM_BRANCH_JMP;
                 break;
 
             case M68K_INS_JSR:
             case M68K_INS_BSR:
-                disasm->instruction.branchType = DISASM_BRANCH_CALL;
+                compact->branchType = DISASM_BRANCH_CALL;
                 break;
 
             case M68K_INS_DBHI:
-                disasm->instruction.branchType = DISASM_BRANCH_JA;
+                compact->branchType = DISASM_BRANCH_JA;
                 break;
             case M68K_INS_DBLS:
-                disasm->instruction.branchType = DISASM_BRANCH_JB;
+                compact->branchType = DISASM_BRANCH_JB;
                 break;
             case M68K_INS_DBCC:
-                disasm->instruction.branchType = DISASM_BRANCH_JNC;
+                compact->branchType = DISASM_BRANCH_JNC;
                 break;
             case M68K_INS_DBCS:
-                disasm->instruction.branchType = DISASM_BRANCH_JC;
+                compact->branchType = DISASM_BRANCH_JC;
                 break;
             case M68K_INS_DBNE:
-                disasm->instruction.branchType = DISASM_BRANCH_JNE;
+                compact->branchType = DISASM_BRANCH_JNE;
                 break;
             case M68K_INS_DBEQ:
-                disasm->instruction.branchType = DISASM_BRANCH_JE;
+                compact->branchType = DISASM_BRANCH_JE;
                 break;
 
             case M68K_INS_DBT:
             case M68K_INS_DBF:
             case M68K_INS_DBVC:
             case M68K_INS_DBVS:
-                disasm->instruction.branchType = DISASM_BRANCH_JNE;
+                compact->branchType = DISASM_BRANCH_JNE;
                 break;
 
             case M68K_INS_DBPL:
-                disasm->instruction.branchType = DISASM_BRANCH_JP;
+                compact->branchType = DISASM_BRANCH_JP;
                 break;
             case M68K_INS_DBMI:
-                disasm->instruction.branchType = DISASM_BRANCH_JNP;
+                compact->branchType = DISASM_BRANCH_JNP;
                 break;
             case M68K_INS_DBGE:
-                disasm->instruction.branchType = DISASM_BRANCH_JGE;
+                compact->branchType = DISASM_BRANCH_JGE;
                 break;
             case M68K_INS_DBLT:
-                disasm->instruction.branchType = DISASM_BRANCH_JL;
+                compact->branchType = DISASM_BRANCH_JL;
                 break;
             case M68K_INS_DBGT:
-                disasm->instruction.branchType = DISASM_BRANCH_JG;
+                compact->branchType = DISASM_BRANCH_JG;
                 break;
             case M68K_INS_DBLE:
-                disasm->instruction.branchType = DISASM_BRANCH_JLE;
+                compact->branchType = DISASM_BRANCH_JLE;
                 break;
             case M68K_INS_DBRA:
-                disasm->instruction.branchType = DISASM_BRANCH_JNE;
+                compact->branchType = DISASM_BRANCH_JNE;
                 break;
 
             case M68K_INS_BRA:
-                disasm->instruction.branchType = DISASM_BRANCH_JMP;
+                compact->branchType = DISASM_BRANCH_JMP;
                 break;
             case M68K_INS_BHI:
-                disasm->instruction.branchType = DISASM_BRANCH_JA;
+                compact->branchType = DISASM_BRANCH_JA;
                 break;
             case M68K_INS_BLS:
-                disasm->instruction.branchType = DISASM_BRANCH_JB;
+                compact->branchType = DISASM_BRANCH_JB;
                 break;
             case M68K_INS_BCC:
-                disasm->instruction.branchType = DISASM_BRANCH_JNC;
+                compact->branchType = DISASM_BRANCH_JNC;
                 break;
             case M68K_INS_BCS:
-                disasm->instruction.branchType = DISASM_BRANCH_JC;
+                compact->branchType = DISASM_BRANCH_JC;
                 break;
             case M68K_INS_BNE:
-                disasm->instruction.branchType = DISASM_BRANCH_JNE;
+                compact->branchType = DISASM_BRANCH_JNE;
                 break;
             case M68K_INS_BEQ:
-                disasm->instruction.branchType = DISASM_BRANCH_JE;
+                compact->branchType = DISASM_BRANCH_JE;
                 break;
             case M68K_INS_BVC:
-                disasm->instruction.branchType = DISASM_BRANCH_JNO;
+                compact->branchType = DISASM_BRANCH_JNO;
                 break;
             case M68K_INS_BVS:
-                disasm->instruction.branchType = DISASM_BRANCH_JO;
+                compact->branchType = DISASM_BRANCH_JO;
                 break;
             case M68K_INS_BPL:
-                disasm->instruction.branchType = DISASM_BRANCH_JA;
+                compact->branchType = DISASM_BRANCH_JA;
                 break;
             case M68K_INS_BMI:
-                disasm->instruction.branchType = DISASM_BRANCH_JB;
+                compact->branchType = DISASM_BRANCH_JB;
                 break;
             case M68K_INS_BGE:
-                disasm->instruction.branchType = DISASM_BRANCH_JNL;
+                compact->branchType = DISASM_BRANCH_JNL;
                 break;
             case M68K_INS_BLT:
-                disasm->instruction.branchType = DISASM_BRANCH_JL;
+                compact->branchType = DISASM_BRANCH_JL;
                 break;
             case M68K_INS_BGT:
-                disasm->instruction.branchType = DISASM_BRANCH_JG;
+                compact->branchType = DISASM_BRANCH_JG;
                 break;
             case M68K_INS_BLE:
-                disasm->instruction.branchType = DISASM_BRANCH_JNG;
+                compact->branchType = DISASM_BRANCH_JNG;
                 break;
         }
     }
 
-    if (cs_insn_group(_handle, insn, M68K_GRP_RET) || cs_insn_group(_handle, insn, M68K_GRP_IRET)) {
-        disasm->instruction.branchType = DISASM_BRANCH_RET;
+    if (cs_insn_group(handle, insn, M68K_GRP_RET) || cs_insn_group(handle, insn, M68K_GRP_IRET)) {
+        compact->branchType = DISASM_BRANCH_RET;
+    }
+
+    compact->instructionClass = instructionClassForInstruction(insn, compact->branchType, isJump);
+    compact->stackDeltaKnown = stackDeltaForInstruction(insn, &compact->stackDelta);
+    compact->predicates = predicatesForInstruction(insn);
+
+    return (int) insn->size;
+}
+
+static int fillDisasmWithInstruction(csh handle, const cs_insn *insn, DisasmStruct *disasm, BOOL lazyMnemonic) {
+    if (disasm->decodeDepth == DISASM_DECODE_DEPTH_LENGTH_ONLY) {
+        // The instruction has been decoded without details: nothing else is known, and
+        // nothing must be left from the previous instruction.
+        DisasmStructReset(disasm, 0);
+        disasm->instruction.length = (uint8_t) insn->size;
+        disasm->instruction.instructionID = M68kInstructionFromCapstone(insn->id);
+        return (int) insn->size;
+    }
+
+    // Only the operands of the previous instruction, and the user data slots
+    // that are set by the operands translation, are cleared.
+    DisasmStructReset(disasm, M68K_OP_USER_DATA_COUNT * sizeof(uint64_t));
+    uint64_t *userData[DISASM_MAX_OPERANDS];
+    for (int i=0; i<DISASM_MAX_OPERANDS; i++) {
+        userData[i] = disasm->operand[i].userData;
+    }
+
+    DisasmCompactStruct compact;
+    compact.virtualAddr = disasm->virtualAddr;
+    int len = fillCompactWithInstruction(handle, insn, &compact, userData, disasm->decodeDepth);
+    DisasmStructFromCompact(disasm, &compact, NULL);
+
+    // When Hopper supports it, the mnemonic is built lazily, by buildMnemonicString:inFile:
+    disasm->instruction.userData = packOperationSize(insn);
+    if (!lazyMnemonic || insn->id == M68K_INS_INVALID) {
+        strcpy(disasm->instruction.mnemonic, insn->mnemonic);
+    }
+    else {
+        disasm->instruction.mnemonic[0] = 0;
+    }
+
+    return len;
+}
+
+// Capstone reads its "0xAAAA" filler past the end of the buffer instead of failing, and
+// reports a truncated instruction as a valid one. Near the end of the available bytes,
+// the length decoder measures the instruction followed by zeroes: it doesn't fit if it
+// is longer than the available bytes. Invalid opcodes, which the length decoder rejects,
+// are still decoded by Capstone, as "dc.w".
+static BOOL instructionFits(HPInstructionLengthDecoder decoder, const uint8_t *bytes, size_t available, NSUInteger mode) {
+    if (available >= M68K_MAX_INSTRUCTION_LENGTH) return YES;
+    if (available < 2) return NO;
+
+    uint8_t padded[M68K_MAX_INSTRUCTION_LENGTH] = { 0 };
+    memcpy(padded, bytes, available);
+    return decoder(padded, sizeof(padded), (uint8_t) mode) <= available;
+}
+
+// Capstone reports at most the size of the "bytes" field of cs_insn, 16 bytes, while the
+// longest instructions are 22 bytes long: their real length comes from the length decoder.
+static void restoreInstructionSize(HPInstructionLengthDecoder decoder, cs_insn *insn, const uint8_t *bytes, size_t available, NSUInteger mode) {
+    if (insn->size < sizeof(insn->bytes)) return;
+    size_t length = decoder(bytes, MIN(available, M68K_MAX_INSTRUCTION_LENGTH), (uint8_t) mode);
+    if (length > insn->size) insn->size = (uint16_t) length;
+}
+
+- (int)disassembleSingleInstruction:(DisasmStruct *)disasm usingProcessorMode:(NSUInteger)mode {
+    if (disasm->bytes == NULL) return DISASM_UNKNOWN_OPCODE;
+    size_t available = DisasmBytesAvailable(disasm);
+    if (!instructionFits(_lengthDecoder, disasm->bytes, available, mode)) return DISASM_UNKNOWN_OPCODE;
+
+    // A cached instruction has been decoded at FULL depth, which is enough for every request.
+    if (_cache.capacity) {
+        int len = cacheLookup(&_cache, disasm, (uint8_t) mode);
+        if (len) {
+            // The cache does not keep the mnemonic.
+            if (!_lazyMnemonics) buildMnemonic(disasm);
+            return len;
+        }
+    }
+
+    csh handle = (disasm->decodeDepth == DISASM_DECODE_DEPTH_LENGTH_ONLY) ? _lengthHandle : _handle;
+
+    cs_insn *insn;
+    size_t count = cs_disasm(handle, disasm->bytes, MIN(available, M68K_MAX_INSTRUCTION_LENGTH), disasm->virtualAddr, 1, &insn);
+    if (count == 0) return DISASM_UNKNOWN_OPCODE;
+    restoreInstructionSize(_lengthDecoder, insn, disasm->bytes, available, mode);
+
+    int len = fillDisasmWithInstruction(handle, insn, disasm, _lazyMnemonics);
+    if (_cache.capacity && disasm->decodeDepth == DISASM_DECODE_DEPTH_FULL && insn->id != M68K_INS_INVALID) {
+        cacheInsert(&_cache, disasm, (uint8_t) mode);
     }
+    cs_free(insn, count);
+
+    return len;
+}
+
+- (NSUInteger)disassembleInstructions:(DisasmStruct *)disasms count:(NSUInteger)count maxBytes:(size_t)maxBytes usingProcessorMode:(NSUInteger)mode {
+    if (count == 0 || disasms->bytes == NULL) return 0;
+
+    const uint8_t *code = disasms->bytes;
+    uint64_t address = disasms->virtualAddr;
+    size_t remaining = maxBytes;
+
+    // The whole run is decoded at the depth requested in the first structure.
+    DisasmDecodeDepth depth = disasms->decodeDepth;
+    csh handle = (depth == DISASM_DECODE_DEPTH_LENGTH_ONLY) ? _lengthHandle : _handle;
+
+    // A single instruction buffer is reused for the whole run, instead of one
+    // allocation per instruction with cs_disasm.
+    cs_insn *insn = cs_malloc(handle);
+    if (insn == NULL) return 0;
+
+    // Capstone does not check that the M68k decoder has enough bytes to read,
+    // so the run stops as soon as the next instruction does not fit.
+    NSUInteger decoded = 0;
+    while (decoded < count && instructionFits(_lengthDecoder, code, remaining, mode)) {
+        DisasmStruct *disasm = disasms + decoded;
+        disasm->bytes = code;
+        disasm->bytesAvailable = remaining;
+        disasm->virtualAddr = address;
+        disasm->decodeDepth = depth;
+        if (!cs_disasm_iter(handle, &code, &remaining, &address, insn)) break;
+        // Capstone advances by the real length, but reports 16 bytes at most.
+        insn->size = (uint16_t) (code - disasm->bytes);
+        fillDisasmWithInstruction(handle, insn, disasm, _lazyMnemonics);
+        decoded++;
+    }
+
+    cs_free(insn, 1);
+
+    return decoded;
+}
+
+- (int)disassembleCompactInstruction:(DisasmCompactStruct *)compact fromBytes:(const uint8_t *)bytes bytesAvailable:(size_t)bytesAvailable usingProcessorMode:(NSUInteger)mode userData:(DisasmOperandUserData *)userData {
+    if (bytes == NULL) return DISASM_UNKNOWN_OPCODE;
+    if (!instructionFits(_lengthDecoder, bytes, bytesAvailable, mode)) return DISASM_UNKNOWN_OPCODE;
 
-    int len = (int) insn->size;
+    cs_insn *insn;
+    size_t count = cs_disasm(_handle, bytes, MIN(bytesAvailable, M68K_MAX_INSTRUCTION_LENGTH), compact->virtualAddr, 1, &insn);
+    if (count == 0) return DISASM_UNKNOWN_OPCODE;
+    restoreInstructionSize(_lengthDecoder, insn, bytes, bytesAvailable, mode);
+
+    // Without a side table, the user data is written in a scratch buffer and dropped.
+    DisasmOperandUserData scratch[DISASM_MAX_OPERANDS];
+    DisasmOperandUserData *dest = (userData != NULL) ? userData : scratch;
+    uint64_t *userDataPtr[DISASM_MAX_OPERANDS];
+    for (int i=0; i<DISASM_MAX_OPERANDS; i++) {
+        userDataPtr[i] = dest[i].userData;
+    }
+
+    int len = fillCompactWithInstruction(_handle, insn, compact, userDataPtr, DISASM_DECODE_DEPTH_FULL);
     cs_free(insn, count);
 
     return len;
@@ -540,6 +1270,10 @@ static inline RegClass capstoneRegisterToRegClass(m68k_reg reg) {
 
 }
 
+- (void)performBranchesAnalysis:(DisasmStruct *)disasm computingNextAddress:(Address *)next output:(BranchAnalysisOutput *)output forProcedure:(NSObject<HPProcedure> *)procedure basicBlock:(NSObject<HPBasicBlock> *)basicBlock ofSegment:(NSObject<HPSegment> *)segment {
+    // The destinations of the M68k branches are direct: Hopper already found them.
+}
+
 - (void)performInstructionSpecificAnalysis:(DisasmStruct *)disasm forProcedure:(NSObject<HPProcedure> *)procedure inSegment:(NSObject<HPSegment> *)segment {
 
 }
@@ -555,12 +1289,7 @@ static inline RegClass capstoneRegisterToRegClass(m68k_reg reg) {
 // Printing
 
 static inline int firstBitIndex(uint64_t mask) {
-    for (int i=0, j=1; i<64; i++, j<<=1) {
-        if (mask & j) {
-            return i;
-        }
-    }
-    return -1;
+    return mask ? __builtin_ctzll(mask) : -1;
 }
 
 static inline RegClass regClassFromType(uint64_t type) {
@@ -571,9 +1300,164 @@ static inline int regIndexFromType(uint64_t type) {
     return firstBitIndex(DISASM_GET_REGISTER_INDEX_MASK(type));
 }
 
+// C rendering of the operands, into an ASMTokenBuffer.
+// It follows buildOperandString:forOperandIndex:inFile:raw:, and returns NO when
+// that method would produce something else (unknown registers, or a number
+// format which needs the help of Hopper).
+
+static BOOL renderRegister(ASMTokenBuffer *buffer, uint8_t opIndex, RegClass regCls, int regIdx, NSUInteger syntaxIndex) {
+    const char *name = M68kRegisterName(regIdx, regCls, syntaxIndex);
+    if (name == NULL) return NO;
+    ASMTokenBufferAppendCString(buffer, ASMToken_Register, opIndex, name, ASM_TOKEN_REGISTER_VALUE(regCls, regIdx));
+    return YES;
+}
+
+static BOOL renderNumber(ASMTokenBuffer *buffer, uint8_t opIndex, int64_t value, ArgFormat format) {
+    char text[80];
+    uint32_t value32 = (uint32_t) value;
+    BOOL isSigned = (format & Format_Signed) != 0;
+    BOOL leadingZeroes = (format & Format_LeadingZeroes) != 0;
+    if (format & Format_Negate) return NO;
+
+    ASMTokenKind kind = ASMToken_Number;
+    switch (format & FORMAT_TYPE_MASK) {
+        case Format_Address:
+            kind = ASMToken_Address;
+            snprintf(text, sizeof(text), "0x%x", value32);
+            break;
+
+        case Format_Default:
+        case Format_Hexadecimal:
+            if (isSigned && (int32_t) value32 < 0) {
+                snprintf(text, sizeof(text), leadingZeroes ? "-0x%08x" : "-0x%x", (uint32_t) -(int64_t) (int32_t) value32);
+            }
+            else {
+                snprintf(text, sizeof(text), leadingZeroes ? "0x%08x" : "0x%x", value32);
+            }
+            break;
+
+        case Format_Decimal:
+            if (isSigned) snprintf(text, sizeof(text), "%d", (int32_t) value32);
+            else snprintf(text, sizeof(text), "%u", value32);
+            break;
+
+        case Format_Octal:
+            snprintf(text, sizeof(text), "0%o", value32);
+            break;
+
+        case Format_Binary: {
+            int top = leadingZeroes ? 31 : (value32 ? 31 - __builtin_clz(value32) : 0);
+            char *ptr = text;
+            *ptr++ = '0';
+            *ptr++ = 'b';
+            for (int bit=top; bit>=0; bit--) *ptr++ = (value32 & (1u << bit)) ? '1' : '0';
+            *ptr = 0;
+            break;
+        }
+
+        default:
+            return NO;
+    }
+
+    ASMTokenBufferAppendCString(buffer, kind, opIndex, text, (kind == ASMToken_Address) ? value32 : (uint64_t) value);
+    return YES;
+}
+
+static BOOL renderOperand(const DisasmStruct *disasm, NSUInteger operandIndex, ArgFormat format, NSUInteger syntaxIndex, ASMTokenBuffer *buffer) {
+    const DisasmOperand *operand = disasm->operand + operandIndex;
+    uint8_t opIndex = (uint8_t) operandIndex;
+
+    if (operand->type & DISASM_OPERAND_CONSTANT_TYPE) {
+        if (disasm->instruction.branchType) {
+            if (format == Format_Default) format = Format_Address;
+        }
+        else {
+            ASMTokenBufferAppend(buffer, ASMToken_Raw, opIndex, "#", 1, 0);
+        }
+        return renderNumber(buffer, opIndex, operand->immediateValue, format);
+    }
+
+    if (operand->type & DISASM_OPERAND_REGISTER_TYPE) {
+        uint16_t lst = operand->userData[DISASM_M68K_OP_USER_REGLIST];
+        if (lst == 0) {
+            // Single register
+            return renderRegister(buffer, opIndex, regClassFromType(operand->type), regIndexFromType(operand->type), syntaxIndex);
+        }
+
+        // Register list: the bits 0 to 7 are D0-D7, and 8 to 15 are A0-A7.
+        // Consecutive registers of the same class are printed as a range.
+        BOOL first = YES;
+        while (lst) {
+            int start = __builtin_ctz(lst);
+            int end = start;
+            while (end < 15 && ((end + 1) & 7) != 0 && (lst & (1 << (end + 1)))) end++;
+            lst &= ~(((1 << (end + 1)) - 1) & ~((1 << start) - 1));
+
+            RegClass regCls = (start < 8) ? RegClass_GeneralPurposeRegister : (RegClass) RegClass_AddressRegister;
+            if (!first) ASMTokenBufferAppend(buffer, ASMToken_Raw, opIndex, "/", 1, 0);
+            if (!renderRegister(buffer, opIndex, regCls, start & 7, syntaxIndex)) return NO;
+            if (end != start) {
+                ASMTokenBufferAppend(buffer, ASMToken_Raw, opIndex, "-", 1, 0);
+                if (!renderRegister(buffer, opIndex, regCls, end & 7, syntaxIndex)) return NO;
+            }
+            first = NO;
+        }
+        return YES;
+    }
+
+    if (operand->type & DISASM_OPERAND_MEMORY_TYPE) {
+        if (operand->memory.baseRegistersMask == 0) {
+            if (format == Format_Default) format = Format_Address;
+            return renderNumber(buffer, opIndex, operand->immediateValue, format);
+        }
+
+        int regIdx = firstBitIndex(operand->memory.baseRegistersMask);
+
+        // PC Indirect with a constant
+        if (operand->memory.indexRegistersMask == 0 && regIdx == 8) {
+            Address ea = disasm->instruction.pcRegisterValue + operand->memory.displacement;
+            if (format == Format_Default) format = Format_Address;
+            return renderNumber(buffer, opIndex, (int64_t) ea, format);
+        }
+
+        if (operand->userData[DISASM_M68K_OP_USER_INCREMENT] == INCR_Predecrement) {
+            ASMTokenBufferAppend(buffer, ASMToken_Raw, opIndex, "-", 1, 0);
+        }
+
+        if (operand->memory.displacement) {
+            if (format == Format_Default) {
+                format = (ArgFormat) (Format_Decimal | Format_Signed);
+            }
+            if (!renderNumber(buffer, opIndex, operand->memory.displacement, format)) return NO;
+        }
+
+        ASMTokenBufferAppend(buffer, ASMToken_Raw, opIndex, "(", 1, 0);
+        if (!renderRegister(buffer, opIndex, (RegClass) RegClass_AddressRegister, regIdx, syntaxIndex)) return NO;
+
+        if (operand->memory.indexRegistersMask) {
+            ASMTokenBufferAppend(buffer, ASMToken_Raw, opIndex, ", ", 2, 0);
+            RegClass regCls = (RegClass) operand->userData[DISASM_M68K_OP_USER_INDEX_REG_CLASS];
+            if (!renderRegister(buffer, opIndex, regCls, firstBitIndex(operand->memory.indexRegistersMask), syntaxIndex)) return NO;
+            if (operand->size == 16) {
+                ASMTokenBufferAppend(buffer, ASMToken_Raw, opIndex, ".W", 2, 0);
+            }
+        }
+
+        ASMTokenBufferAppend(buffer, ASMToken_Raw, opIndex, ")", 1, 0);
+
+        if (operand->userData[DISASM_M68K_OP_USER_INCREMENT] == INCR_Postincrement) {
+            ASMTokenBufferAppend(buffer, ASMToken_Raw, opIndex, "+", 1, 0);
+        }
+        return YES;
+    }
+
+    return YES;
+}
+
 - (NSObject<HPASMLine> *)buildMnemonicString:(DisasmStruct *)disasm inFile:(NSObject<HPDisassembledFile> *)file {
     NSObject<HPHopperServices> *services = _cpu.hopperServices;
     NSObject<HPASMLine> *line = [services blankASMLine];
+    if (disasm->instruction.mnemonic[0] == 0) buildMnemonic(disasm);
     NSString *mnemonic = @(disasm->instruction.mnemonic);
     if (file.userRequestedSyntaxIndex) mnemonic = [mnemonic uppercaseString];
     BOOL isJump = (disasm->instruction.branchType != DISASM_BRANCH_NONE);
@@ -743,6 +1627,16 @@ static inline int regIndexFromType(uint64_t type) {
 - (NSObject<HPASMLine> *)buildCompleteOperandString:(DisasmStruct *)disasm inFile:(NSObject<HPDisassembledFile> *)file raw:(BOOL)raw {
     NSObject<HPHopperServices> *services = _cpu.hopperServices;
 
+    // Render all the operands at once, and build the line in a single call.
+    char text[256];
+    ASMToken tokens[64];
+    ASMTokenBuffer buffer;
+    ASMTokenBufferInit(&buffer, text, sizeof(text), tokens, sizeof(tokens) / sizeof(tokens[0]));
+    if ([self renderCompleteOperand:disasm inFile:file into:&buffer] && !ASMTokenBufferOverflowed(&buffer)) {
+        return [services lineWithTokenBuffer:&buffer];
+    }
+
+    // Some formats need the HPASMLine objects built by Hopper.
     NSObject<HPASMLine> *line = [services blankASMLine];
 
     for (int op_index=0; op_index<=DISASM_MAX_OPERANDS; op_index++) {
@@ -755,6 +1649,25 @@ static inline int regIndexFromType(uint64_t type) {
     return line;
 }
 
+- (BOOL)renderOperand:(DisasmStruct *)disasm forOperandIndex:(NSUInteger)operandIndex inFile:(NSObject<HPDisassembledFile> *)file into:(ASMTokenBuffer *)buffer {
+    if (operandIndex >= DISASM_MAX_OPERANDS) return NO;
+    if (disasm->operand[operandIndex].type == DISASM_OPERAND_NO_OPERAND) return YES;
+
+    ArgFormat format = [file formatForArgument:operandIndex atVirtualAddress:disasm->virtualAddr];
+    return renderOperand(disasm, operandIndex, format, file.userRequestedSyntaxIndex, buffer);
+}
+
+- (BOOL)renderCompleteOperand:(DisasmStruct *)disasm inFile:(NSObject<HPDisassembledFile> *)file into:(ASMTokenBuffer *)buffer {
+    NSUInteger syntaxIndex = file.userRequestedSyntaxIndex;
+    for (int op_index=0; op_index<DISASM_MAX_OPERANDS; op_index++) {
+        if (disasm->operand[op_index].type == DISASM_OPERAND_NO_OPERAND) break;
+        if (op_index) ASMTokenBufferAppend(buffer, ASMToken_Raw, ASM_TOKEN_NO_OPERAND, ", ", 2, 0);
+        ArgFormat format = [file formatForArgument:op_index atVirtualAddress:disasm->virtualAddr];
+        if (!renderOperand(disasm, op_index, format, syntaxIndex, buffer)) return NO;
+    }
+    return YES;
+}
+
 // Decompiler
 
 - (BOOL)canDecompileProcedure:(NSObject<HPProcedure> *)procedure {
@@ -794,7 +1707,7 @@ static inline int regIndexFromType(uint64_t type) {
 }
 
 - (BOOL)instructionOnlyLoadsAddress:(DisasmStruct *)disasmStruct {
-    return strncmp(disasmStruct->instruction.mnemonic, "lea", 3) == 0;
+    return disasmStruct->instruction.instructionID == M68kInstruction_LEA;
 }
 
 - (BOOL)instructionManipulatesFloat:(DisasmStruct *)disasmStruct {
@@ -0,0 +1,388 @@
+//
+//  M68kInstructions.h
+//  M68kCPU
+//
+//  Identifiers of the instructions, stored in the "instructionID" field of DisasmInstruction.
+//  Hopper may keep them, so they never change: unlike the Capstone identifiers, which follow
+//  the Capstone version, a value is never reused, and new instructions are added at the end.
+//
+
+typedef NS_ENUM(uint16_t, M68kInstruction) {
+    M68kInstruction_Invalid = 0,
+    M68kInstruction_ABCD,
+    M68kInstruction_ADD,
+    M68kInstruction_ADDA,
+    M68kInstruction_ADDI,
+    M68kInstruction_ADDQ,
+    M68kInstruction_ADDX,
+    M68kInstruction_AND,
+    M68kInstruction_ANDI,
+    M68kInstruction_ASL,
+    M68kInstruction_ASR,
+    M68kInstruction_BHS,
+    M68kInstruction_BLO,
+    M68kInstruction_BHI,
+    M68kInstruction_BLS,
+    M68kInstruction_BCC,
+    M68kInstruction_BCS,
+    M68kInstruction_BNE,
+    M68kInstruction_BEQ,
+    M68kInstruction_BVC,
+    M68kInstruction_BVS,
+    M68kInstruction_BPL,
+    M68kInstruction_BMI,
+    M68kInstruction_BGE,
+    M68kInstruction_BLT,
+    M68kInstruction_BGT,
+    M68kInstruction_BLE,
+    M68kInstruction_BRA,
+    M68kInstruction_BSR,
+    M68kInstruction_BCHG,
+    M68kInstruction_BCLR,
+    M68kInstruction_BSET,
+    M68kInstruction_BTST,
+    M68kInstruction_BFCHG,
+    M68kInstruction_BFCLR,
+    M68kInstruction_BFEXTS,
+    M68kInstruction_BFEXTU,
+    M68kInstruction_BFFFO,
+    M68kInstruction_BFINS,
+    M68kInstruction_BFSET,
+    M68kInstruction_BFTST,
+    M68kInstruction_BKPT,
+    M68kInstruction_CALLM,
+    M68kInstruction_CAS,
+    M68kInstruction_CAS2,
+    M68kInstruction_CHK,
+    M68kInstruction_CHK2,
+    M68kInstruction_CLR,
+    M68kInstruction_CMP,
+    M68kInstruction_CMPA,
+    M68kInstruction_CMPI,
+    M68kInstruction_CMPM,
+    M68kInstruction_CMP2,
+    M68kInstruction_CINVL,
+    M68kInstruction_CINVP,
+    M68kInstruction_CINVA,
+    M68kInstruction_CPUSHL,
+    M68kInstruction_CPUSHP,
+    M68kInstruction_CPUSHA,
+    M68kInstruction_DBT,
+    M68kInstruction_DBF,
+    M68kInstruction_DBHI,
+    M68kInstruction_DBLS,
+    M68kInstruction_DBCC,
+    M68kInstruction_DBCS,
+    M68kInstruction_DBNE,
+    M68kInstruction_DBEQ,
+    M68kInstruction_DBVC,
+    M68kInstruction_DBVS,
+    M68kInstruction_DBPL,
+    M68kInstruction_DBMI,
+    M68kInstruction_DBGE,
+    M68kInstruction_DBLT,
+    M68kInstruction_DBGT,
+    M68kInstruction_DBLE,
+    M68kInstruction_DBRA,
+    M68kInstruction_DIVS,
+    M68kInstruction_DIVSL,
+    M68kInstruction_DIVU,
+    M68kInstruction_DIVUL,
+    M68kInstruction_EOR,
+    M68kInstruction_EORI,
+    M68kInstruction_EXG,
+    M68kInstruction_EXT,
+    M68kInstruction_EXTB,
+    M68kInstruction_FABS,
+    M68kInstruction_FSABS,
+    M68kInstruction_FDABS,
+    M68kInstruction_FACOS,
+    M68kInstruction_FADD,
+    M68kInstruction_FSADD,
+    M68kInstruction_FDADD,
+    M68kInstruction_FASIN,
+    M68kInstruction_FATAN,
+    M68kInstruction_FATANH,
+    M68kInstruction_FBF,
+    M68kInstruction_FBEQ,
+    M68kInstruction_FBOGT,
+    M68kInstruction_FBOGE,
+    M68kInstruction_FBOLT,
+    M68kInstruction_FBOLE,
+    M68kInstruction_FBOGL,
+    M68kInstruction_FBOR,
+    M68kInstruction_FBUN,
+    M68kInstruction_FBUEQ,
+    M68kInstruction_FBUGT,
+    M68kInstruction_FBUGE,
+    M68kInstruction_FBULT,
+    M68kInstruction_FBULE,
+    M68kInstruction_FBNE,
+    M68kInstruction_FBT,
+    M68kInstruction_FBSF,
+    M68kInstruction_FBSEQ,
+    M68kInstruction_FBGT,
+    M68kInstruction_FBGE,
+    M68kInstruction_FBLT,
+    M68kInstruction_FBLE,
+    M68kInstruction_FBGL,
+    M68kInstruction_FBGLE,
+    M68kInstruction_FBNGLE,
+    M68kInstruction_FBNGL,
+    M68kInstruction_FBNLE,
+    M68kInstruction_FBNLT,
+    M68kInstruction_FBNGE,
+    M68kInstruction_FBNGT,
+    M68kInstruction_FBSNE,
+    M68kInstruction_FBST,
+    M68kInstruction_FCMP,
+    M68kInstruction_FCOS,
+    M68kInstruction_FCOSH,
+    M68kInstruction_FDBF,
+    M68kInstruction_FDBEQ,
+    M68kInstruction_FDBOGT,
+    M68kInstruction_FDBOGE,
+    M68kInstruction_FDBOLT,
+    M68kInstruction_FDBOLE,
+    M68kInstruction_FDBOGL,
+    M68kInstruction_FDBOR,
+    M68kInstruction_FDBUN,
+    M68kInstruction_FDBUEQ,
+    M68kInstruction_FDBUGT,
+    M68kInstruction_FDBUGE,
+    M68kInstruction_FDBULT,
+    M68kInstruction_FDBULE,
+    M68kInstruction_FDBNE,
+    M68kInstruction_FDBT,
+    M68kInstruction_FDBSF,
+    M68kInstruction_FDBSEQ,
+    M68kInstruction_FDBGT,
+    M68kInstruction_FDBGE,
+    M68kInstruction_FDBLT,
+    M68kInstruction_FDBLE,
+    M68kInstruction_FDBGL,
+    M68kInstruction_FDBGLE,
+    M68kInstruction_FDBNGLE,
+    M68kInstruction_FDBNGL,
+    M68kInstruction_FDBNLE,
+    M68kInstruction_FDBNLT,
+    M68kInstruction_FDBNGE,
+    M68kInstruction_FDBNGT,
+    M68kInstruction_FDBSNE,
+    M68kInstruction_FDBST,
+    M68kInstruction_FDIV,
+    M68kInstruction_FSDIV,
+    M68kInstruction_FDDIV,
+    M68kInstruction_FETOX,
+    M68kInstruction_FETOXM1,
+    M68kInstruction_FGETEXP,
+    M68kInstruction_FGETMAN,
+    M68kInstruction_FINT,
+    M68kInstruction_FINTRZ,
+    M68kInstruction_FLOG10,
+    M68kInstruction_FLOG2,
+    M68kInstruction_FLOGN,
+    M68kInstruction_FLOGNP1,
+    M68kInstruction_FMOD,
+    M68kInstruction_FMOVE,
+    M68kInstruction_FSMOVE,
+    M68kInstruction_FDMOVE,
+    M68kInstruction_FMOVECR,
+    M68kInstruction_FMOVEM,
+    M68kInstruction_FMUL,
+    M68kInstruction_FSMUL,
+    M68kInstruction_FDMUL,
+    M68kInstruction_FNEG,
+    M68kInstruction_FSNEG,
+    M68kInstruction_FDNEG,
+    M68kInstruction_FNOP,
+    M68kInstruction_FREM,
+    M68kInstruction_FRESTORE,
+    M68kInstruction_FSAVE,
+    M68kInstruction_FSCALE,
+    M68kInstruction_FSGLDIV,
+    M68kInstruction_FSGLMUL,
+    M68kInstruction_FSIN,
+    M68kInstruction_FSINCOS,
+    M68kInstruction_FSINH,
+    M68kInstruction_FSQRT,
+    M68kInstruction_FSSQRT,
+    M68kInstruction_FDSQRT,
+    M68kInstruction_FSF,
+    M68kInstruction_FSBEQ,
+    M68kInstruction_FSOGT,
+    M68kInstruction_FSOGE,
+    M68kInstruction_FSOLT,
+    M68kInstruction_FSOLE,
+    M68kInstruction_FSOGL,
+    M68kInstruction_FSOR,
+    M68kInstruction_FSUN,
+    M68kInstruction_FSUEQ,
+    M68kInstruction_FSUGT,
+    M68kInstruction_FSUGE,
+    M68kInstruction_FSULT,
+    M68kInstruction_FSULE,
+    M68kInstruction_FSNE,
+    M68kInstruction_FST,
+    M68kInstruction_FSSF,
+    M68kInstruction_FSSEQ,
+    M68kInstruction_FSGT,
+    M68kInstruction_FSGE,
+    M68kInstruction_FSLT,
+    M68kInstruction_FSLE,
+    M68kInstruction_FSGL,
+    M68kInstruction_FSGLE,
+    M68kInstruction_FSNGLE,
+    M68kInstruction_FSNGL,
+    M68kInstruction_FSNLE,
+    M68kInstruction_FSNLT,
+    M68kInstruction_FSNGE,
+    M68kInstruction_FSNGT,
+    M68kInstruction_FSSNE,
+    M68kInstruction_FSST,
+    M68kInstruction_FSUB,
+    M68kInstruction_FSSUB,
+    M68kInstruction_FDSUB,
+    M68kInstruction_FTAN,
+    M68kInstruction_FTANH,
+    M68kInstruction_FTENTOX,
+    M68kInstruction_FTRAPF,
+    M68kInstruction_FTRAPEQ,
+    M68kInstruction_FTRAPOGT,
+    M68kInstruction_FTRAPOGE,
+    M68kInstruction_FTRAPOLT,
+    M68kInstruction_FTRAPOLE,
+    M68kInstruction_FTRAPOGL,
+    M68kInstruction_FTRAPOR,
+    M68kInstruction_FTRAPUN,
+    M68kInstruction_FTRAPUEQ,
+    M68kInstruction_FTRAPUGT,
+    M68kInstruction_FTRAPUGE,
+    M68kInstruction_FTRAPULT,
+    M68kInstruction_FTRAPULE,
+    M68kInstruction_FTRAPNE,
+    M68kInstruction_FTRAPT,
+    M68kInstruction_FTRAPSF,
+    M68kInstruction_FTRAPSEQ,
+    M68kInstruction_FTRAPGT,
+    M68kInstruction_FTRAPGE,
+    M68kInstruction_FTRAPLT,
+    M68kInstruction_FTRAPLE,
+    M68kInstruction_FTRAPGL,
+    M68kInstruction_FTRAPGLE,
+    M68kInstruction_FTRAPNGLE,
+    M68kInstruction_FTRAPNGL,
+    M68kInstruction_FTRAPNLE,
+    M68kInstruction_FTRAPNLT,
+    M68kInstruction_FTRAPNGE,
+    M68kInstruction_FTRAPNGT,
+    M68kInstruction_FTRAPSNE,
+    M68kInstruction_FTRAPST,
+    M68kInstruction_FTST,
+    M68kInstruction_FTWOTOX,
+    M68kInstruction_HALT,
+    M68kInstruction_ILLEGAL,
+    M68kInstruction_JMP,
+    M68kInstruction_JSR,
+    M68kInstruction_LEA,
+    M68kInstruction_LINK,
+    M68kInstruction_LPSTOP,
+    M68kInstruction_LSL,
+    M68kInstruction_LSR,
+    M68kInstruction_MOVE,
+    M68kInstruction_MOVEA,
+    M68kInstruction_MOVEC,
+    M68kInstruction_MOVEM,
+    M68kInstruction_MOVEP,
+    M68kInstruction_MOVEQ,
+    M68kInstruction_MOVES,
+    M68kInstruction_MOVE16,
+    M68kInstruction_MULS,
+    M68kInstruction_MULU,
+    M68kInstruction_NBCD,
+    M68kInstruction_NEG,
+    M68kInstruction_NEGX,
+    M68kInstruction_NOP,
+    M68kInstruction_NOT,
+    M68kInstruction_OR,
+    M68kInstruction_ORI,
+    M68kInstruction_PACK,
+    M68kInstruction_PEA,
+    M68kInstruction_PFLUSH,
+    M68kInstruction_PFLUSHA,
+    M68kInstruction_PFLUSHAN,
+    M68kInstruction_PFLUSHN,
+    M68kInstruction_PLOADR,
+    M68kInstruction_PLOADW,
+    M68kInstruction_PLPAR,
+    M68kInstruction_PLPAW,
+    M68kInstruction_PMOVE,
+    M68kInstruction_PMOVEFD,
+    M68kInstruction_PTESTR,
+    M68kInstruction_PTESTW,
+    M68kInstruction_PULSE,
+    M68kInstruction_REMS,
+    M68kInstruction_REMU,
+    M68kInstruction_RESET,
+    M68kInstruction_ROL,
+    M68kInstruction_ROR,
+    M68kInstruction_ROXL,
+    M68kInstruction_ROXR,
+    M68kInstruction_RTD,
+    M68kInstruction_RTE,
+    M68kInstruction_RTM,
+    M68kInstruction_RTR,
+    M68kInstruction_RTS,
+    M68kInstruction_SBCD,
+    M68kInstruction_ST,
+    M68kInstruction_SF,
+    M68kInstruction_SHI,
+    M68kInstruction_SLS,
+    M68kInstruction_SCC,
+    M68kInstruction_SHS,
+    M68kInstruction_SCS,
+    M68kInstruction_SLO,
+    M68kInstruction_SNE,
+    M68kInstruction_SEQ,
+    M68kInstruction_SVC,
+    M68kInstruction_SVS,
+    M68kInstruction_SPL,
+    M68kInstruction_SMI,
+    M68kInstruction_SGE,
+    M68kInstruction_SLT,
+    M68kInstruction_SGT,
+    M68kInstruction_SLE,
+    M68kInstruction_STOP,
+    M68kInstruction_SUB,
+    M68kInstruction_SUBA,
+    M68kInstruction_SUBI,
+    M68kInstruction_SUBQ,
+    M68kInstruction_SUBX,
+    M68kInstruction_SWAP,
+    M68kInstruction_TAS,
+    M68kInstruction_TRAP,
+    M68kInstruction_TRAPV,
+    M68kInstruction_TRAPT,
+    M68kInstruction_TRAPF,
+    M68kInstruction_TRAPHI,
+    M68kInstruction_TRAPLS,
+    M68kInstruction_TRAPCC,
+    M68kInstruction_TRAPHS,
+    M68kInstruction_TRAPCS,
+    M68kInstruction_TRAPLO,
+    M68kInstruction_TRAPNE,
+    M68kInstruction_TRAPEQ,
+    M68kInstruction_TRAPVC,
+    M68kInstruction_TRAPVS,
+    M68kInstruction_TRAPPL,
+    M68kInstruction_TRAPMI,
+    M68kInstruction_TRAPGE,
+    M68kInstruction_TRAPLT,
+    M68kInstruction_TRAPGT,
+    M68kInstruction_TRAPLE,
+    M68kInstruction_TST,
+    M68kInstruction_UNLK,
+    M68kInstruction_UNPK,
+
+    M68kInstruction_Count
+};
@@ -0,0 +1,178 @@
+//
+//  M68kLengthTableGenerator.c
+//  M68kCPU
+//
+//  Generates M68kCPU/M68kLengthTable.h, the table used by the length decoder of the
+//  M68kCPU plugin, from the vendored Capstone sources, so that the length decoder
+//  always agrees with the decoder used by the CPU context. Run it again after an
+//  update of Capstone:
+//
+//      cd Samples/M68kCPU
+//      cc -O2 -DCAPSTONE_HAS_M68K -DCAPSTONE_USE_SYS_DYN_MEM -IM68kCPU/Capstone/include \
+//          Tools/M68kLengthTableGenerator.c M68kCPU/Capstone/*.c M68kCPU/Capstone/arch/M68K/*.c \
+//          -o /tmp/M68kLengthTableGenerator
+//      /tmp/M68kLengthTableGenerator > M68kCPU/M68kLengthTable.h
+//
+//  This tool is not part of the plugin targets.
+//
+
+#include <assert.h>
+#include <stdbool.h>
+#include <stdio.h>
+#include <stdint.h>
+#include <string.h>
+#include <capstone/capstone.h>
+
+// Layout of an entry, see the "Length decoder" section of M68kCPU.m.
+
+#define M68K_LENGTH_WORDS_MASK      0x000F
+#define M68K_LENGTH_INDEX_FIRST     0x0010
+#define M68K_LENGTH_INDEX_LAST      0x0020
+#define M68K_LENGTH_CHECK_WORD3     0x0040
+#define M68K_LENGTH_WORD2_SHIFT     8
+
+#define M68K_MAX_SECOND_WORD_MASKS  ((0xFFFF >> M68K_LENGTH_WORD2_SHIFT))
+#define M68K_LENGTH_PAGE_SIZE       64      // One page per opcode without its effective address field
+#define M68K_LENGTH_PAGE_COUNT      (0x10000 / M68K_LENGTH_PAGE_SIZE)
+#define M68K_MAX_LENGTH_PAGES       256     // Pages are indexed with an uint8_t
+
+static uint16_t lengthTable[0x10000];
+static uint16_t secondWordMasks[M68K_MAX_SECOND_WORD_MASKS];
+static unsigned secondWordMaskCount;
+
+static uint8_t pageIndex[M68K_LENGTH_PAGE_COUNT];
+static uint16_t pages[M68K_MAX_LENGTH_PAGES][M68K_LENGTH_PAGE_SIZE];
+static unsigned pageCount;
+
+static bool isIndexedAddressMode(m68k_address_mode mode) {
+    switch (mode) {
+        case M68K_AM_AREGI_INDEX_8_BIT_DISP:
+        case M68K_AM_AREGI_INDEX_BASE_DISP:
+        case M68K_AM_MEMI_POST_INDEX:
+        case M68K_AM_MEMI_PRE_INDEX:
+        case M68K_AM_PCI_INDEX_8_BIT_DISP:
+        case M68K_AM_PCI_INDEX_BASE_DISP:
+        case M68K_AM_PC_MEMI_POST_INDEX:
+        case M68K_AM_PC_MEMI_PRE_INDEX:
+            return true;
+        default:
+            return false;
+    }
+}
+
+// Decode an opcode followed by zeroes, except for the second and third words.
+static bool probeOpcode(csh handle, cs_insn *insn, uint16_t opcode, uint16_t secondWord, uint16_t thirdWord) {
+    uint8_t bytes[32] = {
+        opcode >> 8, opcode & 0xFF, secondWord >> 8, secondWord & 0xFF, thirdWord >> 8, thirdWord & 0xFF
+    };
+    const uint8_t *code = bytes;
+    size_t size = sizeof(bytes);
+    uint64_t address = 0;
+    return cs_disasm_iter(handle, &code, &size, &address, insn) && insn->id != M68K_INS_INVALID;
+}
+
+static unsigned secondWordMaskIndex(uint16_t mask) {
+    unsigned index = 0;
+    while (index < secondWordMaskCount && secondWordMasks[index] != mask) index++;
+    if (index == secondWordMaskCount) {
+        assert(secondWordMaskCount < M68K_MAX_SECOND_WORD_MASKS);
+        secondWordMasks[secondWordMaskCount++] = mask;
+    }
+    return index;
+}
+
+static void buildLengthTable(void) {
+    // The 68010 mode of the CPU context. Capstone also decodes the full extension
+    // format in this mode, which the length decoder handles at run time.
+    csh handle;
+    if (cs_open(CS_ARCH_M68K, CS_MODE_32, &handle) != CS_ERR_OK) {
+        fprintf(stderr, "cannot open Capstone\n");
+        assert(0);
+    }
+    cs_option(handle, CS_OPT_DETAIL, CS_OPT_ON);
+    cs_insn *insn = cs_malloc(handle);
+
+    for (uint32_t opcode=0; opcode<0x10000; opcode++) {
+        if (!probeOpcode(handle, insn, opcode, 0, 0)) continue;
+
+        // With zeroes, the extension words are in the brief format, and the instruction
+        // is short enough for Capstone to report its real size.
+        assert(insn->size >= 2 && insn->size < sizeof(insn->bytes) && (insn->size & 1) == 0);
+        uint16_t entry = insn->size / 2;
+        assert(entry <= M68K_LENGTH_WORDS_MASK);
+
+        bool isMove = (opcode >> 12) >= 1 && (opcode >> 12) <= 3;
+        const cs_m68k *m68k = &insn->detail->m68k;
+        for (uint8_t i=0; i<m68k->op_count; i++) {
+            if (isIndexedAddressMode(m68k->operands[i].address_mode)) {
+                entry |= (isMove && i == 0) ? M68K_LENGTH_INDEX_FIRST : M68K_LENGTH_INDEX_LAST;
+            }
+        }
+
+        if (!probeOpcode(handle, insn, opcode, 0xFFFF, 0)) {
+            // Find the bits of the second word which make the opcode invalid.
+            uint16_t mask = 0;
+            for (int bit=0; bit<16; bit++) {
+                if (!probeOpcode(handle, insn, opcode, 1 << bit, 0)) mask |= 1 << bit;
+            }
+            assert(mask != 0);
+            entry |= (secondWordMaskIndex(mask) + 1) << M68K_LENGTH_WORD2_SHIFT;
+            if (!probeOpcode(handle, insn, opcode, 0, 0xFFFF)) entry |= M68K_LENGTH_CHECK_WORD3;
+        }
+
+        lengthTable[opcode] = entry;
+    }
+
+    cs_free(insn, 1);
+    cs_close(&handle);
+}
+
+// Most opcodes only differ by their registers: identical pages of the table are shared.
+static void buildPages(void) {
+    for (unsigned page=0; page<M68K_LENGTH_PAGE_COUNT; page++) {
+        const uint16_t *entries = lengthTable + page * M68K_LENGTH_PAGE_SIZE;
+        unsigned index = 0;
+        while (index < pageCount && memcmp(pages[index], entries, sizeof(pages[index])) != 0) index++;
+        if (index == pageCount) {
+            assert(pageCount < M68K_MAX_LENGTH_PAGES);
+            memcpy(pages[pageCount++], entries, sizeof(pages[index]));
+        }
+        pageIndex[page] = (uint8_t) index;
+    }
+}
+
+int main(void) {
+    buildLengthTable();
+    buildPages();
+
+    printf("//\n");
+    printf("//  M68kLengthTable.h\n");
+    printf("//  M68kCPU\n");
+    printf("//\n");
+    printf("//  Generated by Tools/M68kLengthTableGenerator.c from the Capstone sources. Do not edit.\n");
+    printf("//\n\n");
+
+    printf("#define M68K_LENGTH_PAGE_SIZE   %d\n\n", M68K_LENGTH_PAGE_SIZE);
+
+    printf("static const uint16_t m68kSecondWordMasks[%u] = {\n   ", secondWordMaskCount);
+    for (unsigned i=0; i<secondWordMaskCount; i++) printf(" 0x%04X,", secondWordMasks[i]);
+    printf("\n};\n\n");
+
+    printf("static const uint8_t m68kLengthPageIndex[%d] = {\n", M68K_LENGTH_PAGE_COUNT);
+    for (unsigned i=0; i<M68K_LENGTH_PAGE_COUNT; i++) {
+        printf("%s%2u,%s", (i % 16) ? " " : "    ", pageIndex[i], (i % 16 == 15) ? "\n" : "");
+    }
+    printf("};\n\n");
+
+    printf("static const uint16_t m68kLengthPages[%u][M68K_LENGTH_PAGE_SIZE] = {\n", pageCount);
+    for (unsigned page=0; page<pageCount; page++) {
+        printf("    {\n");
+        for (unsigned i=0; i<M68K_LENGTH_PAGE_SIZE; i++) {
+            printf("%s0x%04X,%s", (i % 8) ? " " : "        ", pages[page][i], (i % 8 == 7) ? "\n" : "");
+        }
+        printf("    },\n");
+    }
+    printf("};\n");
+
+    return 0;
+}
@@ -9,6 +9,12 @@
 #import "SampleTool.h"
 #import <Hopper/HPHopperServices.h>
 #import <Hopper/HPDocument.h>
+#import <Hopper/HPDisassembledFile.h>
+#import <Hopper/HPSegment.h>
+#import <Hopper/HPProcedure.h>
+#import <Hopper/HPBasicBlock.h>
+#import <Hopper/CPUContext.h>
+#import <Hopper/CPUDefinition.h>
 
 @implementation SampleTool {
     NSObject<HPHopperServices> *_services;
@@ -25,6 +31,16 @@
                        @{HPM_TITLE: @"Fct 3",
                          HPM_SELECTOR: @"fct3:"}
                      ]
+               },
+             @{HPM_TITLE: @"Benchmarks",
+               HPM_SUBMENU: @[
+                       @{HPM_TITLE: @"Decode Depths",
+                         HPM_SELECTOR: @"benchmarkDecodeDepths:"},
+                       @{HPM_TITLE: @"Line Building",
+                         HPM_SELECTOR: @"benchmarkLineBuilding:"},
+                       @{HPM_TITLE: @"Analysis Hooks",
+                         HPM_SELECTOR: @"benchmarkAnalysisHooks:"}
+                     ]
                }
              ];
 }
@@ -55,6 +71,200 @@
     [doc logStringMessage:@"Function 3 triggered"];
 }
 
+// Mapped bytes of the segment used by a benchmark, decoded in place: the CPU doesn't read past "bytesAvailable".
+typedef struct {
+    const uint8_t *bytes;
+    Address start;
+    size_t length;
+    uint8_t mode;
+} BenchmarkBytes;
+
+// Runs a benchmark on the current segment. The CPU context is built once, and "run" is called
+// for each variant, with its index, and returns the number of processed items. The elapsed time
+// and the throughput of each variant are logged, "unit" being the name of the items.
+- (void)benchmarkCurrentSegment:(NSString *)title variants:(NSArray<NSString *> *)variants unit:(NSString *)unit requiresProcedures:(BOOL)requiresProcedures
+                     usingBlock:(NSUInteger (^)(NSObject<HPDisassembledFile> *file, NSObject<HPSegment> *segment, NSObject<CPUContext> *ctx, BenchmarkBytes bytes, NSUInteger variant))run {
+    NSObject<HPDocument> *doc = [_services currentDocument];
+    NSObject<HPDisassembledFile> *file = [doc disassembledFile];
+    NSObject<HPSegment> *segment = [doc currentSegment];
+    if (file == nil || segment == nil || ![segment hasMappedData] || (requiresProcedures && [segment procedureCount] == 0)) {
+        [doc logErrorStringMessage:requiresProcedures ? @"Benchmark: no analyzed segment at the current address"
+                                                      : @"Benchmark: no mapped segment at the current address"];
+        return;
+    }
+
+    NSData *data = [segment mappedData];
+    NSObject<CPUContext> *ctx = [file buildCPUContext];
+    BenchmarkBytes bytes = { data.bytes, [segment startAddress], data.length, 0 };
+    bytes.mode = [file cpuModeAtVirtualAddress:bytes.start];
+
+    [doc beginToWait:@"Benchmarking…"];
+    [variants enumerateObjectsUsingBlock:^(NSString *name, NSUInteger variant, BOOL *stop) {
+        NSTimeInterval begin = [NSDate timeIntervalSinceReferenceDate];
+        NSUInteger count = run(file, segment, ctx, bytes, variant);
+        NSTimeInterval duration = [NSDate timeIntervalSinceReferenceDate] - begin;
+        [doc logInfoMessage:[NSString stringWithFormat:@"%@ with %@: %lu %@ in %.3f s, %.0f %@/s",
+                             title, name, (unsigned long) count, unit, duration, (duration > 0 ? count / duration : 0), unit]];
+    }];
+    [doc endWaiting];
+}
+
+// Linear sweep of the segment. "visit", when set, is called for each decoded instruction.
+// Returns the number of decoded instructions.
+static NSUInteger sweepSegment(NSObject<CPUContext> *ctx, DisasmStruct *disasm, BenchmarkBytes bytes, void (^visit)(DisasmStruct *disasm)) {
+    NSUInteger count = 0;
+    Address end = bytes.start + bytes.length;
+    Address address = bytes.start;
+    while (address < end) {
+        disasm->bytes = bytes.bytes + (address - bytes.start);
+        disasm->bytesAvailable = (size_t) (end - address);
+        disasm->virtualAddr = address;
+        int len = [ctx disassembleSingleInstruction:disasm usingProcessorMode:bytes.mode];
+        if (len <= 0) {
+            address = [ctx nextAddressToTryIfInstructionFailedToDecodeAt:address forCPUMode:bytes.mode];
+            continue;
+        }
+        address += len;
+        if (visit) visit(disasm);
+        count++;
+    }
+    return count;
+}
+
+- (void)benchmarkDecodeDepths:(id)sender {
+    static const DisasmDecodeDepth depths[] = {
+        DISASM_DECODE_DEPTH_FULL, DISASM_DECODE_DEPTH_FLOW, DISASM_DECODE_DEPTH_LENGTH_ONLY
+    };
+    [self benchmarkCurrentSegment:@"Decode depth" variants:@[@"FULL", @"FLOW", @"LENGTH_ONLY"] unit:@"instructions" requiresProcedures:NO
+                       usingBlock:^NSUInteger(NSObject<HPDisassembledFile> *file, NSObject<HPSegment> *segment, NSObject<CPUContext> *ctx, BenchmarkBytes bytes, NSUInteger variant) {
+        DisasmStruct disasm;
+        [ctx initDisasmStructure:&disasm withSyntaxIndex:0];
+        disasm.decodeDepth = depths[variant];
+        return sweepSegment(ctx, &disasm, bytes, nil);
+    }];
+}
+
+// Builds the mnemonic and operands lines of every instruction of the current segment.
+// With the first variant, the operands are built one by one with the HPASMLine methods,
+// otherwise the CPU context builds them at once, using the token constructor when it supports it.
+- (void)benchmarkLineBuilding:(id)sender {
+    [self benchmarkCurrentSegment:@"Lines built" variants:@[@"HPASMLine appends", @"token constructor"] unit:@"lines" requiresProcedures:NO
+                       usingBlock:^NSUInteger(NSObject<HPDisassembledFile> *file, NSObject<HPSegment> *segment, NSObject<CPUContext> *ctx, BenchmarkBytes bytes, NSUInteger variant) {
+        BOOL appendOperands = (variant == 0);
+        DisasmStruct disasm;
+        [ctx initDisasmStructure:&disasm withSyntaxIndex:file.userRequestedSyntaxIndex];
+        return sweepSegment(ctx, &disasm, bytes, ^(DisasmStruct *instruction) {
+            @autoreleasepool {
+                NSObject<HPASMLine> *line = [ctx buildMnemonicString:instruction inFile:file];
+                [line appendSpacesUntil:10];
+                if (appendOperands) {
+                    for (NSUInteger op_index=0; op_index<DISASM_MAX_OPERANDS; op_index++) {
+                        NSObject<HPASMLine> *part = [ctx buildOperandString:instruction forOperandIndex:op_index inFile:file raw:NO];
+                        if (part == nil) break;
+                        if (op_index) [line appendRawString:@", "];
+                        [line append:part];
+                    }
+                }
+                else {
+                    [line append:[ctx buildCompleteOperandString:instruction inFile:file raw:NO]];
+                }
+            }
+        });
+    }];
+}
+
+// Replays the analysis of the procedures of a segment, sending the analysis hooks of
+// the CPU context the way Hopper does, but only those which are set in "hooks".
+// Returns the number of analyzed instructions.
+static NSUInteger replayAnalysis(NSObject<HPSegment> *segment, NSObject<CPUContext> *ctx, CPUContextHooks hooks, BenchmarkBytes bytes) {
+    DisasmStruct disasm;
+    [ctx initDisasmStructure:&disasm withSyntaxIndex:0];
+    disasm.decodeDepth = DISASM_DECODE_DEPTH_FLOW;
+
+    Address branches[64];
+    CallDestination calledAddresses[64];
+    Address callSites[64];
+    BranchAnalysisOutput output = {
+        branches, 0, 64,
+        calledAddresses, 0, 64,
+        callSites, 0, 64
+    };
+    BOOL allocationFree = [ctx respondsToSelector:@selector(performBranchesAnalysis:computingNextAddress:output:forProcedure:basicBlock:ofSegment:)];
+    NSArray<NSObject<HPProcedure> *> *procedures = [segment procedures];
+    Address start = bytes.start;
+    Address end = bytes.start + bytes.length;
+
+    NSUInteger count = 0;
+    if (hooks & CPUHook_AnalysisBeginsAt) [ctx analysisBeginsAt:start];
+    for (NSObject<HPProcedure> *procedure in procedures) {
+        Address entryPoint = [procedure entryPoint];
+        if (hooks & CPUHook_ProcedureAnalysisBegins) [ctx procedureAnalysisBeginsForProcedure:procedure atEntryPoint:entryPoint];
+        if (hooks & CPUHook_ResetDisassembler) [ctx resetDisassembler];
+
+        NSUInteger blockCount = [procedure basicBlockCount];
+        for (NSUInteger blockIndex=0; blockIndex<blockCount; blockIndex++) {
+            NSObject<HPBasicBlock> *basicBlock = [procedure basicBlockAtIndex:blockIndex];
+            if (hooks & CPUHook_ProcedureAnalysisContinuesOnBasicBlock) [ctx procedureAnalysisContinuesOnBasicBlock:basicBlock];
+
+            Address address = [basicBlock from];
+            Address to = MIN([basicBlock to], end);
+            while (address >= start && address < to) {
+                disasm.bytes = bytes.bytes + (address - start);
+                disasm.bytesAvailable = (size_t) (end - address);
+                disasm.virtualAddr = address;
+                int len = [ctx disassembleSingleInstruction:&disasm usingProcessorMode:bytes.mode];
+                if (len <= 0) break;
+                Address next = address + len;
+                count++;
+
+                if (hooks & CPUHook_PerformProcedureAnalysis) [ctx performProcedureAnalysis:procedure basicBlock:basicBlock disasm:&disasm];
+                if (hooks & CPUHook_UpdateProcedureAnalysis) [ctx updateProcedureAnalysis:&disasm];
+                if ((hooks & CPUHook_PerformBranchesAnalysis) && disasm.instruction.branchType != DISASM_BRANCH_NONE) {
+                    if (allocationFree) {
+                        output.branchCount = output.calledAddressCount = output.callSiteCount = 0;
+                        [ctx performBranchesAnalysis:&disasm computingNextAddress:&next output:&output
+                                        forProcedure:procedure basicBlock:basicBlock ofSegment:segment];
+                    }
+                    else {
+                        @autoreleasepool {
+                            [ctx performBranchesAnalysis:&disasm computingNextAddress:&next
+                                             andBranches:[NSMutableArray array]
+                                            forProcedure:procedure basicBlock:basicBlock ofSegment:segment
+                                         calledAddresses:[NSMutableArray array] callsites:[NSMutableArray array]];
+                        }
+                    }
+                }
+                if (hooks & CPUHook_PerformInstructionSpecificAnalysis) [ctx performInstructionSpecificAnalysis:&disasm forProcedure:procedure inSegment:segment];
+                address += len;
+            }
+        }
+
+        if (hooks & CPUHook_ProcedureAnalysisOfProlog) [ctx procedureAnalysisOfPrologForProcedure:procedure atEntryPoint:entryPoint];
+        if (hooks & CPUHook_ProcedureAnalysisOfEpilog) [ctx procedureAnalysisOfEpilogForProcedure:procedure atEntryPoint:entryPoint];
+        if (hooks & CPUHook_ProcedureAnalysisEnded) [ctx procedureAnalysisEndedForProcedure:procedure atEntryPoint:entryPoint];
+    }
+    if (hooks & CPUHook_AnalysisEnded) [ctx analysisEnded];
+
+    return count;
+}
+
+- (void)benchmarkAnalysisHooks:(id)sender {
+    NSObject<CPUDefinition> *cpu = [[[_services currentDocument] disassembledFile] cpuDefinition];
+    CPUContextHooks implemented = CPUHook_All;
+    if ([cpu respondsToSelector:@selector(implementedContextHooks)]) {
+        implemented = [cpu implementedContextHooks];
+    }
+
+    NSArray<NSString *> *variants = @[
+        [NSString stringWithFormat:@"all hooks (0x%lx)", (unsigned long) CPUHook_All],
+        [NSString stringWithFormat:@"implemented hooks (0x%lx)", (unsigned long) implemented]
+    ];
+    [self benchmarkCurrentSegment:@"Analysis" variants:variants unit:@"instructions" requiresProcedures:YES
+                       usingBlock:^NSUInteger(NSObject<HPDisassembledFile> *file, NSObject<HPSegment> *segment, NSObject<CPUContext> *ctx, BenchmarkBytes bytes, NSUInteger variant) {
+        return replayAnalysis(segment, ctx, (variant == 0) ? CPUHook_All : implemented, bytes);
+    }];
+}
+
 + (int)sdkVersion {
     return HOPPER_CURRENT_SDK_VERSION;
 }
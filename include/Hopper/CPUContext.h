@@ -12,6 +12,9 @@
 
 #import <Foundation/Foundation.h>
 #include "DisasmStruct.h"
+#import "HPHopperServices.h"
+#import "HPCallDestination.h"
+#import "HPASMLine.h"
 
 @protocol HPSegment;
 @protocol HPProcedure;
@@ -24,10 +27,62 @@
 @class Decompiler;
 @class ASTNode;
 
+/// C counterpart of an object conforming to the HPCallDestination protocol.
+typedef struct {
+    Address address;
+    BOOL    cpuModeIsKnown;
+    uint8_t cpuMode;
+} CallDestination;
+
+/// Output of the allocation-free branch analysis. The buffers are owned by Hopper.
+/// The plugin appends values with the BranchAnalysisAdd… functions below. A count is incremented even when the
+/// buffer is full, so that Hopper can detect the overflow, and call the method again with larger buffers.
+typedef struct {
+    Address         *branches;
+    size_t           branchCount;
+    size_t           branchCapacity;
+
+    CallDestination *calledAddresses;
+    size_t           calledAddressCount;
+    size_t           calledAddressCapacity;
+
+    Address         *callSites;
+    size_t           callSiteCount;
+    size_t           callSiteCapacity;
+} BranchAnalysisOutput;
+
+static inline void BranchAnalysisAddBranch(BranchAnalysisOutput * _Nonnull output, Address address) {
+    if (output->branchCount < output->branchCapacity) output->branches[output->branchCount] = address;
+    output->branchCount++;
+}
+
+static inline void BranchAnalysisAddCalledAddress(BranchAnalysisOutput * _Nonnull output, Address address, BOOL cpuModeIsKnown, uint8_t cpuMode) {
+    if (output->calledAddressCount < output->calledAddressCapacity) {
+        CallDestination *dest = output->calledAddresses + output->calledAddressCount;
+        dest->address = address;
+        dest->cpuModeIsKnown = cpuModeIsKnown;
+        dest->cpuMode = cpuMode;
+    }
+    output->calledAddressCount++;
+}
+
+static inline void BranchAnalysisAddCallSite(BranchAnalysisOutput * _Nonnull output, Address address) {
+    if (output->callSiteCount < output->callSiteCapacity) output->callSites[output->callSiteCount] = address;
+    output->callSiteCount++;
+}
+
+static inline BOOL BranchAnalysisOverflowed(const BranchAnalysisOutput * _Nonnull output) {
+    return output->branchCount > output->branchCapacity
+        || output->calledAddressCount > output->calledAddressCapacity
+        || output->callSiteCount > output->callSiteCapacity;
+}
+
 @protocol CPUContext
 
 - (nonnull NSObject<CPUDefinition> *)cpuDefinition;
 
+/// Initialize a structure for a syntax variant. The structure is then reused for many instructions: see the
+/// reset contract of DisasmStruct.h. The plugin should start with DisasmStructInit.
 - (void)initDisasmStructure:(nonnull DisasmStruct*)disasm withSyntaxIndex:(NSUInteger)syntaxIndex;
 
 ////////////////////////////////////////////////////////////////////////////////
@@ -88,8 +143,11 @@
 - (void)resetDisassembler;
 
 /// Disassemble a single instruction, filling the DisasmStruct structure.
-/// Only a few fields are set by Hopper (mainly, the syntaxIndex, the "bytes" field and the virtualAddress of the instruction).
-/// The CPU should fill as much information as possible.
+/// Only a few fields are set by Hopper (mainly, the syntaxIndex, the "bytes" and "bytesAvailable" fields and the virtualAddress of the instruction).
+/// The CPU should fill as much information as possible, within the limits of the "decodeDepth" field: when Hopper
+/// only asks for the length, or the control flow of the instruction, the plugin should skip the rest of the work.
+/// When the plugin fills the "instruction.predicates" field, and sets its "authoritative" bit, Hopper doesn't
+/// send the instruction… predicates, nor cpuModeForNextInstruction:, for this instruction.
 - (int)disassembleSingleInstruction:(nonnull DisasmStruct *)disasm usingProcessorMode:(NSUInteger)mode;
 
 /// Returns whether or not an instruction may halt the processor (like the HLT Intel instruction).
@@ -194,4 +252,203 @@
 
 - (nonnull NSData *)assembleRawInstruction:(nonnull NSString *)instr atAddress:(Address)addr forFile:(nonnull NSObject<HPDisassembledFile> *)file withCPUMode:(uint8_t)cpuMode usingSyntaxVariant:(NSUInteger)syntax error:(NSError * _Nullable * _Nullable)error;
 
+////////////////////////////////////////////////////////////////////////////////
+//
+// Optional methods
+//
+////////////////////////////////////////////////////////////////////////////////
+
+@optional
+
+/// Disassemble a run of consecutive instructions in a single call, filling the "disasms" array.
+/// Every structure of the array must have been initialized with "initDisasmStructure:withSyntaxIndex:".
+/// Hopper only sets the "bytes" and "virtualAddr" fields of the first structure: the plugin sets them, and
+/// "bytesAvailable", for the following instructions, and fills each structure as "disassembleSingleInstruction:usingProcessorMode:" would.
+/// Decoding stops after "count" instructions, when an instruction would extend past "maxBytes" bytes from
+/// the first one, or when an instruction fails to decode.
+/// Returns the number of instructions decoded.
+/// Plugins which do not implement this method are driven through HPDisassembleInstructions (see below).
+- (NSUInteger)disassembleInstructions:(nonnull DisasmStruct *)disasms count:(NSUInteger)count maxBytes:(size_t)maxBytes usingProcessorMode:(NSUInteger)mode;
+
+/// Disassemble a single instruction into the compact representation, used by the analysis passes
+/// which keep the instructions of a whole procedure in memory.
+/// Hopper sets the "virtualAddr" field of the structure, and leaves "userDataIndex" untouched. The plugin must not
+/// read more than "bytesAvailable" bytes, as for the "bytesAvailable" field of DisasmStruct.
+/// If "userData" is not NULL, it points to DISASM_MAX_OPERANDS entries of the side table, which receive
+/// what the plugin would store in the "userData" field of the operands of a DisasmStruct.
+/// Returns the length of the instruction, or DISASM_UNKNOWN_OPCODE.
+- (int)disassembleCompactInstruction:(nonnull DisasmCompactStruct *)compact fromBytes:(nonnull const uint8_t *)bytes bytesAvailable:(size_t)bytesAvailable usingProcessorMode:(NSUInteger)mode userData:(nullable DisasmOperandUserData *)userData;
+
+/// Called when bytes of the file have been modified, by one of the "write" methods of HPDocument, by the assembler,
+/// or by a script. The context must drop any state derived from the bytes of the range, like the instructions
+/// it cached, before it decodes them again.
+- (void)bytesChangedInRange:(AddressRange)range;
+
+/// Returns a new context for the same file, which shares no mutable state with the receiver, or nil if the
+/// plugin cannot provide one. Hopper calls this method from a single thread, before the analysis starts, and builds
+/// one clone per thread used to create the procedures. Each clone is only used by one thread at a time.
+/// When a plugin implements this method, the following methods may be called at the same time on different clones:
+///   - initDisasmStructure:withSyntaxIndex:
+///   - adjustCodeAddress:, cpuModeFromAddress:, addressForcesACPUMode:, nextAddressToTryIfInstructionFailedToDecodeAt:forCPUMode:
+///   - isNopAt:, hasProcedurePrologAt:, detectedPaddingLengthAt:
+///   - procedureAnalysisBeginsForProcedure:atEntryPoint: and the other procedureAnalysis… notifications,
+///     always for different procedures
+///   - disassembleSingleInstruction:usingProcessorMode:, disassembleInstructions:count:maxBytes:usingProcessorMode:,
+///     disassembleCompactInstruction:fromBytes:bytesAvailable:usingProcessorMode:userData:
+///   - instructionHaltsExecutionFlow:, performProcedureAnalysis:basicBlock:disasm:, updateProcedureAnalysis:
+///   - the instruction… predicates, cpuModeForNextInstruction:
+///   - performBranchesAnalysis:…, performInstructionSpecificAnalysis:forProcedure:inSegment:
+///   - getThunkDestinationForInstructionAt:
+/// Every other method, in particular analysisBeginsAt:, analysisEnded, resetDisassembler, bytesChangedInRange:,
+/// and the printing, decompiler and assembler methods, is only called on the original context, while no clone is in use.
+/// Without this method, the analysis of a file runs on a single thread.
+- (nullable NSObject<CPUContext> *)cloneForConcurrentAnalysis;
+
+/// Range variants of "hasProcedurePrologAt:" and "detectedPaddingLengthAt:", used to scan a whole segment at once.
+/// Returns the sorted list of the addresses of the range where "hasProcedurePrologAt:" would return YES.
+- (nonnull NSArray<NSNumber *> *)procedurePrologCandidatesInRange:(AddressRange)range;
+/// Returns the sorted list of the padding runs of the range, as NSValue objects holding an AddressRange.
+/// Each run is the longest one starting at its address, and runs don't overlap: a run which reaches the end of a segment
+/// continues in the next one when they are contiguous, and the last run may end after the range, like "detectedPaddingLengthAt:".
+- (nonnull NSArray<NSValue *> *)paddingRunsInRange:(AddressRange)range;
+
+/// Range variant of "estimateCPUModeAtVirtualAddress:", used on a whole section at once.
+/// Returns a run-length map of the estimated CPU modes, as NSValue objects holding a CPUModeRun, sorted by address.
+/// The runs cover the mapped bytes of the range, don't overlap, and two adjacent runs have different modes.
+/// The plugin should decode the range once, and score the modes with a sliding window, instead of decoding
+/// overlapping windows for each address.
+- (nonnull NSArray<NSValue *> *)estimateCPUModesForRange:(AddressRange)range;
+
+/// Allocation-free variant of "performBranchesAnalysis:computingNextAddress:andBranches:…".
+/// The destinations are written in the buffers of "output", whose counts are set to 0 by Hopper, instead of arrays
+/// of NSNumber and HPCallDestination objects. When this method exists, Hopper calls it instead of the NSArray form.
+/// A plugin can implement the NSArray form by calling HPPerformBranchesAnalysisIntoArrays (see below).
+- (void)performBranchesAnalysis:(nonnull DisasmStruct *)disasm
+           computingNextAddress:(nonnull Address *)next
+                         output:(nonnull BranchAnalysisOutput *)output
+                   forProcedure:(nonnull NSObject<HPProcedure> *)procedure
+                     basicBlock:(nonnull NSObject<HPBasicBlock> *)basicBlock
+                      ofSegment:(nonnull NSObject<HPSegment> *)segment;
+
+/// C-level variants of "buildOperandString:forOperandIndex:inFile:raw:" and "buildCompleteOperandString:inFile:raw:".
+/// The text of the operands is appended to the UTF-8 buffer, with one token per register, number or address, so that
+/// Hopper can draw the instruction without building HPASMLine objects. Numbers are written using the format requested
+/// by the user, and Hopper replaces the address tokens by the names it knows. There is no "raw" variant: the tokens
+/// are the same, and Hopper decides whether it substitutes the names.
+/// Return NO if the plugin cannot render the operand this way, for instance because of a format it does not handle:
+/// Hopper then uses the HPASMLine methods. If the buffer overflowed, Hopper calls the method again with larger buffers.
+- (BOOL)renderOperand:(nonnull DisasmStruct *)disasm forOperandIndex:(NSUInteger)operandIndex inFile:(nonnull NSObject<HPDisassembledFile> *)file into:(nonnull ASMTokenBuffer *)buffer;
+- (BOOL)renderCompleteOperand:(nonnull DisasmStruct *)disasm inFile:(nonnull NSObject<HPDisassembledFile> *)file into:(nonnull ASMTokenBuffer *)buffer;
+
 @end
+
+/// Disassemble a run of consecutive instructions using the batch method of the context if it exists,
+/// or by calling "disassembleSingleInstruction:usingProcessorMode:" for each instruction otherwise.
+static inline NSUInteger HPDisassembleInstructions(NSObject<CPUContext> * _Nonnull ctx, DisasmStruct * _Nonnull disasms, NSUInteger count, size_t maxBytes, NSUInteger mode) {
+    if ([ctx respondsToSelector:@selector(disassembleInstructions:count:maxBytes:usingProcessorMode:)]) {
+        return [ctx disassembleInstructions:disasms count:count maxBytes:maxBytes usingProcessorMode:mode];
+    }
+
+    NSUInteger decoded = 0;
+    size_t offset = 0;
+    while (decoded < count && offset < maxBytes) {
+        DisasmStruct *disasm = disasms + decoded;
+        disasm->bytes = disasms->bytes + offset;
+        disasm->bytesAvailable = maxBytes - offset;
+        disasm->virtualAddr = disasms->virtualAddr + offset;
+        int len = [ctx disassembleSingleInstruction:disasm usingProcessorMode:mode];
+        if (len <= 0 || offset + len > maxBytes) break;
+        offset += len;
+        decoded++;
+    }
+
+    return decoded;
+}
+
+/// A pool of structures initialized once by a CPU context for a syntax variant, so that a decode loop never
+/// calls "initDisasmStructure:withSyntaxIndex:" again. A loop which uses several syntax variants keeps one arena
+/// per syntax index. The plugin resets the structures itself when it decodes into them (see DisasmStructReset).
+typedef struct {
+    DisasmStruct * _Nullable structs;
+    NSUInteger               count;
+    NSUInteger               syntaxIndex;
+} DisasmStructArena;
+
+/// Allocate "count" structures, and initialize them with the context. Returns NO if the allocation failed.
+static inline BOOL HPDisasmStructArenaInit(DisasmStructArena * _Nonnull arena, NSObject<CPUContext> * _Nonnull ctx, NSUInteger count, NSUInteger syntaxIndex) {
+    arena->structs = (DisasmStruct *) malloc(count * sizeof(DisasmStruct));
+    arena->count = arena->structs ? count : 0;
+    arena->syntaxIndex = syntaxIndex;
+    for (NSUInteger i=0; i<arena->count; i++) {
+        [ctx initDisasmStructure:arena->structs + i withSyntaxIndex:syntaxIndex];
+        arena->structs[i].syntaxIndex = (uint8_t) syntaxIndex;
+    }
+    return arena->structs != NULL || count == 0;
+}
+
+static inline void HPDisasmStructArenaRelease(DisasmStructArena * _Nonnull arena) {
+    free(arena->structs);
+    arena->structs = NULL;
+    arena->count = 0;
+}
+
+/// Compatibility shim: run the allocation-free branch analysis of a context, and append its results to the arrays
+/// of the NSArray form of "performBranchesAnalysis:…". The call destination objects are built by "services".
+static inline void HPPerformBranchesAnalysisIntoArrays(NSObject<CPUContext> * _Nonnull ctx,
+                                                       NSObject<HPHopperServices> * _Nonnull services,
+                                                       DisasmStruct * _Nonnull disasm,
+                                                       Address * _Nonnull next,
+                                                       NSMutableArray<NSNumber *> * _Nonnull branches,
+                                                       NSObject<HPProcedure> * _Nonnull procedure,
+                                                       NSObject<HPBasicBlock> * _Nonnull basicBlock,
+                                                       NSObject<HPSegment> * _Nonnull segment,
+                                                       NSMutableArray<NSObject<HPCallDestination> *> * _Nonnull calledAddresses,
+                                                       NSMutableArray<NSNumber *> * _Nonnull callSitesAddresses) {
+    Address branchBuffer[16];
+    CallDestination calledBuffer[16];
+    Address callSiteBuffer[16];
+    BranchAnalysisOutput output = {
+        branchBuffer, 0, 16,
+        calledBuffer, 0, 16,
+        callSiteBuffer, 0, 16
+    };
+
+    Address initialNext = *next;
+    [ctx performBranchesAnalysis:disasm computingNextAddress:next output:&output forProcedure:procedure basicBlock:basicBlock ofSegment:segment];
+
+    Address *branchStorage = NULL;
+    CallDestination *calledStorage = NULL;
+    Address *callSiteStorage = NULL;
+    if (BranchAnalysisOverflowed(&output)) {
+        // Run the analysis again, with buffers large enough for everything.
+        branchStorage = (Address *) malloc(output.branchCount * sizeof(Address));
+        calledStorage = (CallDestination *) malloc(output.calledAddressCount * sizeof(CallDestination));
+        callSiteStorage = (Address *) malloc(output.callSiteCount * sizeof(Address));
+        output = (BranchAnalysisOutput) {
+            branchStorage, 0, output.branchCount,
+            calledStorage, 0, output.calledAddressCount,
+            callSiteStorage, 0, output.callSiteCount
+        };
+        *next = initialNext;
+        [ctx performBranchesAnalysis:disasm computingNextAddress:next output:&output forProcedure:procedure basicBlock:basicBlock ofSegment:segment];
+    }
+
+    for (size_t i=0; i<output.branchCount && i<output.branchCapacity; i++) {
+        [branches addObject:@(output.branches[i])];
+    }
+    for (size_t i=0; i<output.calledAddressCount && i<output.calledAddressCapacity; i++) {
+        const CallDestination *dest = output.calledAddresses + i;
+        NSObject<HPCallDestination> *obj = dest->cpuModeIsKnown
+                                          ? [services callDestination:dest->address withCPUMode:dest->cpuMode]
+                                          : [services callDestination:dest->address];
+        if (obj) [calledAddresses addObject:obj];
+    }
+    for (size_t i=0; i<output.callSiteCount && i<output.callSiteCapacity; i++) {
+        [callSitesAddresses addObject:@(output.callSites[i])];
+    }
+
+    free(branchStorage);
+    free(calledStorage);
+    free(callSiteStorage);
+}
+
@@ -15,6 +15,40 @@
 #import "HopperPlugin.h"
 #import "CommonTypes.h"
 
+/// A NOP instruction pattern. Regions are filled by repeating the "period" first bytes of "bytes".
+/// A period of 0 means that the CPU has no such pattern.
+typedef struct {
+    const uint8_t * _Nullable bytes;
+    NSUInteger period;
+} NOPPattern;
+
+/// A pure function returning the length, in bytes, of the instruction starting at "bytes", or 0 if the bytes
+/// don't start a valid instruction, or if the instruction is longer than "available" bytes.
+/// It must not keep any state, nor use the Objective-C runtime, so that Hopper can call it from any thread,
+/// in tight loops, such as linear sweeps or code/data boundaries detection.
+typedef size_t (*HPInstructionLengthDecoder)(const uint8_t * _Nonnull bytes, size_t available, uint8_t cpuMode);
+
+/// The analysis hooks of CPUContext, as returned by the "implementedContextHooks" method of CPUDefinition.
+/// All of them return void, so that Hopper can skip a hook without changing the result of the analysis.
+HP_BEGIN_DECL_OPTIONS(NSUInteger, CPUContextHooks) {
+    CPUHook_None                                    = 0,
+    CPUHook_AnalysisBeginsAt                        = (1 << 0),
+    CPUHook_AnalysisEnded                           = (1 << 1),
+    CPUHook_ProcedureAnalysisBegins                 = (1 << 2),
+    CPUHook_ProcedureAnalysisOfProlog               = (1 << 3),
+    CPUHook_ProcedureAnalysisOfEpilog               = (1 << 4),
+    CPUHook_ProcedureAnalysisEnded                  = (1 << 5),
+    CPUHook_ProcedureAnalysisContinuesOnBasicBlock  = (1 << 6),
+    CPUHook_ResetDisassembler                       = (1 << 7),
+    CPUHook_PerformProcedureAnalysis                = (1 << 8),
+    CPUHook_UpdateProcedureAnalysis                 = (1 << 9),
+    CPUHook_PerformBranchesAnalysis                 = (1 << 10),
+    CPUHook_PerformInstructionSpecificAnalysis      = (1 << 11),
+
+    CPUHook_All                                     = (1 << 12) - 1
+}
+HP_END_DECL_OPTIONS(CPUContextHooks);
+
 @protocol CPUDefinition <NSObject,HopperPlugin>
 
 /// Build a context for disassembling.
@@ -64,4 +98,48 @@
 /// publicly exposed yet.
 - (BOOL)canDecompileProceduresForCPUFamily:(nullable NSString *)family andSubFamily:(nullable NSString *)subFamily;
 
+@optional
+
+/// Returns the names of the instructions, indexed by the "instructionID" field of DisasmInstruction.
+/// The table is built once: Hopper calls this method a single time, and keeps the result.
+- (nonnull NSArray<NSString *> *)instructionMnemonics;
+
+/// Returns the names of the registers of a class, for a syntax variant, indexed by register index.
+/// The tables are built once: Hopper calls this method a single time per class and syntax variant when the
+/// plugin is loaded, and then looks the names up by index instead of calling "registerIndexToString:…".
+/// The arrays, and the strings they contain, must never change.
+/// Returns nil if the names of the class depend on the bit size or position of the register.
+- (nullable NSArray<NSString *> *)registerNamesForClass:(RegClass)reg_class syntaxIndex:(NSUInteger)syntaxIndex;
+
+/// Returns the NOP pattern of a CPU mode. The bytes must stay valid as long as the plugin is loaded.
+/// When a pattern is returned, Hopper fills the regions to NOP with it, instead of calling
+/// "nopWithSize:andMode:forFile:". Only sizes which are a multiple of the period can be filled.
+- (NOPPattern)nopPatternForMode:(NSUInteger)cpuMode;
+
+/// Returns a length decoder for the instructions of this CPU, or NULL. Hopper calls this method a single time,
+/// and keeps the result. The decoder must return the same lengths as "disassembleSingleInstruction:…".
+- (nullable HPInstructionLengthDecoder)instructionLengthDecoder;
+
+/// Returns the analysis hooks which have a non-empty implementation in the CPUContext class of the plugin.
+/// Hopper calls this method a single time, and never sends the other hooks: a plugin whose hooks are empty
+/// saves a message per procedure, basic block, or instruction. The bit of "performBranchesAnalysis:…" covers
+/// both forms of the method. Without this method, Hopper calls every hook (CPUHook_All).
+- (CPUContextHooks)implementedContextHooks;
+
 @end
+
+/// Fill "size" bytes with a NOP pattern, copying the already filled part of the buffer in
+/// a doubling number of bytes. Returns NO, and leaves the buffer untouched, if the size is not a
+/// multiple of the period of the pattern.
+static inline BOOL HPFillWithNOPPattern(uint8_t * _Nonnull buffer, size_t size, NOPPattern pattern) {
+    if (pattern.period == 0 || pattern.bytes == NULL || size % pattern.period) return NO;
+    if (size == 0) return YES;
+    memcpy(buffer, pattern.bytes, pattern.period);
+    size_t filled = pattern.period;
+    while (filled < size) {
+        size_t chunk = (filled < size - filled) ? filled : size - filled;
+        memcpy(buffer + filled, buffer, chunk);
+        filled += chunk;
+    }
+    return YES;
+}
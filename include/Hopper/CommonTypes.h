@@ -27,6 +27,18 @@ typedef struct {
 
 #define BAD_ADDRESS     ((Address)-1)
 
+/// A run of consecutive addresses using the same CPU mode.
+typedef struct {
+    AddressRange range;
+    uint8_t      cpuMode;
+} CPUModeRun;
+
+/// Bytes of the file, read in place. "length" is 0 when nothing is mapped.
+typedef struct {
+    const uint8_t * _Nullable bytes;
+    size_t                    length;
+} ByteSpan;
+
 // Colors
 
 typedef uint32_t Color;
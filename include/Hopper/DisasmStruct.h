@@ -13,7 +13,9 @@
 #ifndef _HOPPER_DISASM_STRUCT_H_
 #define _HOPPER_DISASM_STRUCT_H_
 
+#include <stddef.h>
 #include <stdint.h>
+#include <string.h>
 #include "CommonTypes.h"
 
 #define DISASM_INSTRUCTION_MAX_LENGTH 2048
@@ -226,6 +228,50 @@ typedef enum {
     DISASM_INST_COND_NEVER
 } DisasmCondition;
 
+typedef enum {
+    DISASM_INST_CLASS_UNKNOWN,
+    /// Moves, loads, stores, stack pushes and pops, address computations...
+    DISASM_INST_CLASS_DATA_TRANSFER,
+    DISASM_INST_CLASS_ARITHMETIC,
+    /// Boolean operations, shifts, rotations and bit manipulations
+    DISASM_INST_CLASS_LOGICAL,
+    /// Instructions which only update the CPU state register, like CMP or TEST
+    DISASM_INST_CLASS_COMPARE,
+    /// Jumps, conditional or not
+    DISASM_INST_CLASS_BRANCH,
+    DISASM_INST_CLASS_CALL,
+    DISASM_INST_CLASS_RETURN,
+    /// Privileged instructions, traps, cache and MMU management...
+    DISASM_INST_CLASS_SYSTEM,
+    DISASM_INST_CLASS_FLOAT,
+    DISASM_INST_CLASS_NOP
+} DisasmInstructionClass;
+
+/// How much of the DisasmStruct the plugin fills. At every depth, the fields which are not listed are
+/// left in the state of DisasmStructInit (no operands, DISASM_BRANCH_NONE, empty mnemonic…), never with
+/// the values of the previous instruction.
+typedef enum {
+    /// Everything the plugin knows about the instruction. This is the default.
+    DISASM_DECODE_DEPTH_FULL,
+    /// The instruction length, and what is needed to follow the control flow: instructionID, branchType,
+    /// addressValue, pcRegisterValue, instructionClass, stackDelta and stackDeltaKnown, the predicates,
+    /// and the operand which is the branch destination, if any. The other operands may be missing.
+    DISASM_DECODE_DEPTH_FLOW,
+    /// Only the instruction length, and the instructionID, are valid.
+    DISASM_DECODE_DEPTH_LENGTH_ONLY
+} DisasmDecodeDepth;
+
+/// How the "stackDelta" field of an instruction is to be used.
+typedef enum {
+    /// The effect of the instruction on the stack pointer is unknown.
+    DISASM_STACK_DELTA_UNKNOWN = 0,
+    /// The instruction adds "stackDelta" to the stack pointer.
+    DISASM_STACK_DELTA_KNOWN,
+    /// The stack pointer gets back the value it had before the instruction which set the frame
+    /// pointer up (like the M68k "link" instruction), plus "stackDelta". For instance, "unlk".
+    DISASM_STACK_DELTA_FROM_FRAME
+} DisasmStackDeltaKind;
+
 typedef enum {
     DISASM_SHIFT_NONE,
     DISASM_SHIFT_LSL,
@@ -307,6 +353,27 @@ typedef struct {
     unsigned changeNextInstrMode : 1;
 } DisasmInstrFlags;
 
+/// Answers of the instruction predicates of the CPUContext protocol, filled by the plugin during the
+/// decoding, at the FULL and FLOW depths. When "authoritative" is set, Hopper reads these fields instead of
+/// sending the corresponding messages.
+typedef struct {
+    /// Set to 1 by the plugin when the other fields are filled.
+    unsigned authoritative : 1;
+
+    /// instructionHaltsExecutionFlow:
+    unsigned haltsExecutionFlow : 1;
+    /// instructionOnlyLoadsAddress:
+    unsigned onlyLoadsAddress : 1;
+    /// instructionManipulatesFloat:
+    unsigned manipulatesFloat : 1;
+    /// instructionCanBeUsedToExtractDirectMemoryReferences:
+    unsigned canBeUsedToExtractDirectMemoryReferences : 1;
+    /// instructionMayBeASwitchStatement:
+    unsigned mayBeASwitchStatement : 1;
+    /// cpuModeForNextInstruction:, only used when the "changeNextInstrMode" special flag is set.
+    unsigned cpuModeForNextInstruction : 8;
+} DisasmInstrPredicates;
+
 /// Define a memory access in the form [BASE_REGISTERS + (INDEX_REGISTERS) * SCALE + DISPLACEMENT]
 typedef struct {
     /// Mask of the base registers used
@@ -321,6 +388,9 @@ typedef struct {
 
 typedef struct  {
     /// Instruction mnemonic, with its optional condition.
+    /// A plugin which sets the "instructionID" field may leave it empty during the decoding, and only fill it
+    /// when the instruction is printed, in "buildMnemonicString:inFile:", if the "supportsLazyMnemonics"
+    /// method of HPHopperServices returns YES.
     char                mnemonic[32];
 
     /// Mnemonic string without the conditional part.
@@ -328,6 +398,12 @@ typedef struct  {
     /// Condition to be met to execute instruction.
     DisasmCondition     condition;
 
+    /// A numerical identifier of the instruction, defined by the plugin, and stable across runs. 0 if unknown.
+    /// The name associated to each identifier is given by the "instructionMnemonics" method of the CPUDefinition.
+    uint16_t            instructionID;
+    /// Broad category of the instruction.
+    DisasmInstructionClass instructionClass;
+
     /// A field that you can use internally to keep information on the instruction. Hopper don't need
     uintptr_t           userData;
 
@@ -347,7 +423,14 @@ typedef struct  {
     /// Anyway, it must reflects the exact value of the PC register if read from the instruction.
     Address             pcRegisterValue;
 
+    /// Change of the stack pointer caused by the instruction, in bytes, negative when the stack grows.
+    /// Filled by the plugin during the decoding, so that the stack pointer offset of each instruction of a basic block
+    /// is the sum of the deltas of the previous ones. Calls are expected to leave the stack pointer unchanged.
+    int32_t             stackDelta;
+    DisasmStackDeltaKind stackDeltaKnown;
+
     DisasmInstrFlags    specialFlags;
+    DisasmInstrPredicates predicates;
 } DisasmInstruction;
 
 typedef struct {
@@ -398,12 +481,22 @@ typedef struct {
     /// Address where you can read the bytes to be decoded. Set by Hopper.
     const uint8_t *   bytes;
 
+    /// Number of bytes which can be read at the "bytes" address. Set by Hopper.
+    /// The plugin must not read past this bound: the bytes may point straight into the mapped data of a segment,
+    /// up to its last byte. An instruction which does not fit must be reported as DISASM_UNKNOWN_OPCODE.
+    /// A value of 0 means that the caller doesn't know the bound, which then is DISASM_INSTRUCTION_MAX_LENGTH.
+    size_t            bytesAvailable;
+
     /// Virtual address in the disassembled file space. Set by Hopper.
     Address           virtualAddr;
 
     /// Syntax to be used when building the various mnemonics.
     uint8_t           syntaxIndex;
 
+    /// How much information the plugin has to decode. Set by Hopper.
+    /// Fields which are not required at this depth may be left untouched by the plugin.
+    DisasmDecodeDepth decodeDepth;
+
     /// You can set the CPU, CPUSubType to any value during the initialization of the structure.
     /// These values are only used by plugins for their own purpose. Hopper don't need them.
     int32_t           CPU;
@@ -411,6 +504,9 @@ typedef struct {
     CPUEndianess      endianess;
 
     /// Fields to be set by the plugin.
+    /// Number of entries of "operand" used by the instruction. The following entries are DISASM_OPERAND_NO_OPERAND,
+    /// and otherwise zeroed, so that DisasmStructReset only has to clear the operands of the previous instruction.
+    uint8_t           operandCount;
     DisasmPrefix      prefix;
     DisasmInstruction instruction;
 
@@ -422,4 +518,268 @@ typedef struct {
     DisasmOperand     operand[DISASM_MAX_OPERANDS];
 } DisasmStruct;
 
+// Reset contract
+//
+// A DisasmStruct is initialized once with DisasmStructInit (or by the "initDisasmStructure:withSyntaxIndex:"
+// method of the CPU context, which calls it), and then reused for every instruction. Instead of clearing the
+// whole structure, a plugin calls DisasmStructReset before decoding: it clears the fields set by the plugin,
+// up to the operands, and only the "operandCount" operands of the previous instruction. A plugin which writes
+// more operands than it declares in "operandCount", or more than "userDataSize" bytes of their user data,
+// breaks the contract, and must clear the structure itself.
+
+/// Clear the structure, and mark all its operands as DISASM_OPERAND_NO_OPERAND.
+static inline void DisasmStructInit(DisasmStruct *disasm) {
+    memset(disasm, 0, sizeof(DisasmStruct));
+    for (int i=0; i<DISASM_MAX_OPERANDS; i++) {
+        disasm->operand[i].type = DISASM_OPERAND_NO_OPERAND;
+    }
+}
+
+/// Bring a structure used for a previous instruction back to the state left by DisasmStructInit, keeping the
+/// fields set by Hopper ("bytes", "virtualAddr", "syntaxIndex"…) and by the initialization ("CPU", "endianess"…).
+/// Only the first "userDataSize" bytes of the user data of the operands are cleared.
+static inline void DisasmStructReset(DisasmStruct *disasm, size_t userDataSize) {
+    uint8_t count = disasm->operandCount;
+    if (count > DISASM_MAX_OPERANDS) count = DISASM_MAX_OPERANDS;
+    if (userDataSize > sizeof(disasm->operand[0].userData)) userDataSize = sizeof(disasm->operand[0].userData);
+
+    memset(&disasm->operandCount, 0, offsetof(DisasmStruct, operand) - offsetof(DisasmStruct, operandCount));
+    for (int i=0; i<count; i++) {
+        DisasmOperand *op = disasm->operand + i;
+        memset(op, 0, offsetof(DisasmOperand, userData) + userDataSize);
+        op->type = DISASM_OPERAND_NO_OPERAND;
+    }
+}
+
+/// Number of bytes which can be read at the "bytes" address of a DisasmStruct.
+static inline size_t DisasmBytesAvailable(const DisasmStruct *disasm) {
+    return disasm->bytesAvailable ? disasm->bytesAvailable : DISASM_INSTRUCTION_MAX_LENGTH;
+}
+
+// Compact representation
+//
+// A DisasmStruct is about 2KB, mostly because of the "userData" field of its operands.
+// The following structures only keep the fields used by the flow analysis, so that all
+// the instructions of a procedure can stay in the CPU caches. The plugin specific data
+// is stored out-of-line, in a side table of DisasmOperandUserData managed by the caller.
+
+/// Out-of-line storage of the "userData" field of a DisasmOperand.
+typedef union {
+    uint64_t           userData[DISASM_MAX_USER_DATA];
+    char               userString[DISASM_MAX_USER_DATA * 8];
+} DisasmOperandUserData;
+
+/// Value of the "userDataIndex" field when the instruction has no entry in the side table.
+#define DISASM_COMPACT_NO_USER_DATA                     0xFFFFFFFFu
+
+typedef struct {
+    /// Mask of DISASM_OPERAND_* values.
+    DisasmOperandType  type;
+    /// Description of the memory indirection.
+    DisasmMemoryAccess memory;
+
+    union {
+        /// The immediate value for this operand, if known.
+        int64_t            immediateValue;
+        double             immediateDoubleValue;
+    };
+
+    /// Argument size in bits.
+    uint32_t           size;
+    /// A value different from 0 if the operand is used to compute a destination address for a branch instruction
+    uint8_t            isBranchDestination;
+} DisasmCompactOperand;
+
+typedef struct {
+    /// Virtual address in the disassembled file space. Set by Hopper.
+    Address              virtualAddr;
+    /// A value computed from one of the operands, known to point to an address.
+    Address              addressValue;
+    /// The value of the PC register at this address.
+    Address              pcRegisterValue;
+    /// Information on the type of branch this instruction can perform.
+    DisasmBranchType     branchType;
+    /// Broad category of the instruction.
+    DisasmInstructionClass instructionClass;
+    /// Plugin defined identifier of the instruction.
+    uint16_t             instructionID;
+    /// Change of the stack pointer caused by the instruction.
+    int32_t              stackDelta;
+    DisasmStackDeltaKind stackDeltaKnown;
+    /// Answers of the instruction predicates.
+    DisasmInstrPredicates predicates;
+    /// Index of the first of the DISASM_MAX_OPERANDS entries of this instruction in the user data side table,
+    /// or DISASM_COMPACT_NO_USER_DATA. Managed by the owner of the table, plugins don't touch it.
+    uint32_t             userDataIndex;
+    /// Length in bytes of the instruction encoding.
+    uint8_t              length;
+    /// Number of entries of "operand" used by the instruction.
+    uint8_t              operandCount;
+
+    DisasmCompactOperand operand[DISASM_MAX_OPERANDS];
+} DisasmCompactStruct;
+
+/// Copy the hot fields of a DisasmStruct in a DisasmCompactStruct.
+/// If "userData" is not NULL, it must point to DISASM_MAX_OPERANDS entries, which receive the operands user data.
+static inline void DisasmCompactFromStruct(DisasmCompactStruct *compact, const DisasmStruct *disasm, DisasmOperandUserData *userData) {
+    compact->virtualAddr = disasm->virtualAddr;
+    compact->addressValue = disasm->instruction.addressValue;
+    compact->pcRegisterValue = disasm->instruction.pcRegisterValue;
+    compact->branchType = disasm->instruction.branchType;
+    compact->instructionClass = disasm->instruction.instructionClass;
+    compact->instructionID = disasm->instruction.instructionID;
+    compact->stackDelta = disasm->instruction.stackDelta;
+    compact->stackDeltaKnown = disasm->instruction.stackDeltaKnown;
+    compact->predicates = disasm->instruction.predicates;
+    compact->length = disasm->instruction.length;
+    compact->operandCount = disasm->operandCount;
+    for (int i=0; i<DISASM_MAX_OPERANDS; i++) {
+        const DisasmOperand *op = disasm->operand + i;
+        DisasmCompactOperand *compactOp = compact->operand + i;
+        compactOp->type = op->type;
+        compactOp->memory = op->memory;
+        compactOp->immediateValue = op->immediateValue;
+        compactOp->size = op->size;
+        compactOp->isBranchDestination = op->isBranchDestination;
+        if (userData) memcpy(userData[i].userData, op->userData, sizeof(DisasmOperandUserData));
+    }
+}
+
+/// Copy the fields of a DisasmCompactStruct back in a DisasmStruct. Other fields are left untouched.
+/// If "userData" is not NULL, it must point to DISASM_MAX_OPERANDS entries, copied in the operands user data.
+static inline void DisasmStructFromCompact(DisasmStruct *disasm, const DisasmCompactStruct *compact, const DisasmOperandUserData *userData) {
+    disasm->virtualAddr = compact->virtualAddr;
+    disasm->instruction.addressValue = compact->addressValue;
+    disasm->instruction.pcRegisterValue = compact->pcRegisterValue;
+    disasm->instruction.branchType = compact->branchType;
+    disasm->instruction.instructionClass = compact->instructionClass;
+    disasm->instruction.instructionID = compact->instructionID;
+    disasm->instruction.stackDelta = compact->stackDelta;
+    disasm->instruction.stackDeltaKnown = compact->stackDeltaKnown;
+    disasm->instruction.predicates = compact->predicates;
+    disasm->instruction.length = compact->length;
+    disasm->operandCount = compact->operandCount;
+    for (int i=0; i<DISASM_MAX_OPERANDS; i++) {
+        DisasmOperand *op = disasm->operand + i;
+        const DisasmCompactOperand *compactOp = compact->operand + i;
+        op->type = compactOp->type;
+        op->memory = compactOp->memory;
+        op->immediateValue = compactOp->immediateValue;
+        op->size = compactOp->size;
+        op->isBranchDestination = compactOp->isBranchDestination;
+        if (userData) memcpy(op->userData, userData[i].userData, sizeof(DisasmOperandUserData));
+    }
+}
+
+// Register sets
+//
+// A DisasmRegisterSet holds one bit per register of every class (DISASM_MAX_REG_CLASSES x DISASM_MAX_REG_INDEX bits),
+// so that dataflow analysis can combine the registers used by instructions with a few wide operations instead of
+// a loop per register class. The register "index" of class "cls" is the bit (cls * DISASM_MAX_REG_INDEX + index).
+
+#define DISASM_REGISTER_SET_WORDS                       (DISASM_MAX_REG_CLASSES * DISASM_MAX_REG_INDEX / 64)
+
+typedef struct {
+    uint64_t words[DISASM_REGISTER_SET_WORDS];
+} __attribute__((aligned(64))) DisasmRegisterSet;
+
+static inline void DisasmRegisterSetClear(DisasmRegisterSet *set) {
+    for (int i=0; i<DISASM_REGISTER_SET_WORDS; i++) set->words[i] = 0;
+}
+
+static inline void DisasmRegisterSetAddRegister(DisasmRegisterSet *set, unsigned cls, unsigned index) {
+    unsigned bit = cls * DISASM_MAX_REG_INDEX + index;
+    set->words[bit >> 6] |= 1llu << (bit & 63);
+}
+
+static inline int DisasmRegisterSetContainsRegister(const DisasmRegisterSet *set, unsigned cls, unsigned index) {
+    unsigned bit = cls * DISASM_MAX_REG_INDEX + index;
+    return (set->words[bit >> 6] >> (bit & 63)) & 1;
+}
+
+/// Returns the mask of the registers of a class, in the DISASM_BUILD_REGISTER_INDEX_MASK format.
+static inline uint32_t DisasmRegisterSetRegistersOfClass(const DisasmRegisterSet *set, unsigned cls) {
+    return (uint32_t) (set->words[cls >> 1] >> ((cls & 1) * DISASM_MAX_REG_INDEX));
+}
+
+/// result = a | b. The result may be one of the operands.
+static inline void DisasmRegisterSetUnion(DisasmRegisterSet *result, const DisasmRegisterSet *a, const DisasmRegisterSet *b) {
+    for (int i=0; i<DISASM_REGISTER_SET_WORDS; i++) result->words[i] = a->words[i] | b->words[i];
+}
+
+/// result = a & b. The result may be one of the operands.
+static inline void DisasmRegisterSetIntersection(DisasmRegisterSet *result, const DisasmRegisterSet *a, const DisasmRegisterSet *b) {
+    for (int i=0; i<DISASM_REGISTER_SET_WORDS; i++) result->words[i] = a->words[i] & b->words[i];
+}
+
+/// result = a & ~b. The result may be one of the operands.
+static inline void DisasmRegisterSetDifference(DisasmRegisterSet *result, const DisasmRegisterSet *a, const DisasmRegisterSet *b) {
+    for (int i=0; i<DISASM_REGISTER_SET_WORDS; i++) result->words[i] = a->words[i] & ~b->words[i];
+}
+
+/// Returns a non zero value if the two sets have at least one register in common.
+static inline int DisasmRegisterSetIntersects(const DisasmRegisterSet *a, const DisasmRegisterSet *b) {
+    uint64_t acc = 0;
+    for (int i=0; i<DISASM_REGISTER_SET_WORDS; i++) acc |= a->words[i] & b->words[i];
+    return acc != 0;
+}
+
+static inline int DisasmRegisterSetIsEmpty(const DisasmRegisterSet *set) {
+    uint64_t acc = 0;
+    for (int i=0; i<DISASM_REGISTER_SET_WORDS; i++) acc |= set->words[i];
+    return acc == 0;
+}
+
+static inline int DisasmRegisterSetIsEqual(const DisasmRegisterSet *a, const DisasmRegisterSet *b) {
+    uint64_t acc = 0;
+    for (int i=0; i<DISASM_REGISTER_SET_WORDS; i++) acc |= a->words[i] ^ b->words[i];
+    return acc == 0;
+}
+
+/// Add the registers of an operand "type" field to the set.
+/// The DisasmOperandType format does not tell which index goes with which class: when several classes are set,
+/// every index is added to every class.
+static inline void DisasmRegisterSetAddOperandType(DisasmRegisterSet *set, DisasmOperandType type) {
+    uint64_t indexes = DISASM_GET_REGISTER_INDEX_MASK(type);
+    uint64_t classes = DISASM_GET_REGISTER_CLS_MASK(type);
+    if (indexes == 0) return;
+    while (classes) {
+        unsigned cls = (unsigned) __builtin_ctzll(classes);
+        set->words[cls >> 1] |= indexes << ((cls & 1) * DISASM_MAX_REG_INDEX);
+        classes &= classes - 1;
+    }
+}
+
+/// Add an array of DISASM_MAX_REG_CLASSES masks, like the "implicitlyReadRegisters" field of a DisasmStruct, to the set.
+static inline void DisasmRegisterSetAddClassMasks(DisasmRegisterSet *set, const uint32_t masks[DISASM_MAX_REG_CLASSES]) {
+    for (int i=0; i<DISASM_REGISTER_SET_WORDS; i++) {
+        set->words[i] |= (uint64_t) masks[2 * i] | ((uint64_t) masks[2 * i + 1] << DISASM_MAX_REG_INDEX);
+    }
+}
+
+/// Add the registers read and written by an instruction to the "read" and "written" sets.
+/// Registers used to compute the address of a memory operand are read. Implicit registers are included.
+/// Either set can be NULL.
+static inline void DisasmRegisterSetAddInstruction(DisasmRegisterSet *read, DisasmRegisterSet *written, const DisasmStruct *disasm) {
+    for (int i=0; i<DISASM_MAX_OPERANDS; i++) {
+        const DisasmOperand *op = disasm->operand + i;
+        if (op->type == DISASM_OPERAND_NO_OPERAND) break;
+        if (op->type & DISASM_OPERAND_REGISTER_TYPE) {
+            if (read && (op->accessMode & DISASM_ACCESS_READ)) DisasmRegisterSetAddOperandType(read, op->type);
+            if (written && (op->accessMode & DISASM_ACCESS_WRITE)) DisasmRegisterSetAddOperandType(written, op->type);
+        }
+        else if (op->type & DISASM_OPERAND_MEMORY_TYPE) {
+            if (read) {
+                // The base and index registers, in the register classes of the operand, or the general registers.
+                uint64_t addressRegisters = op->memory.baseRegistersMask | op->memory.indexRegistersMask;
+                DisasmOperandType type = op->type | (addressRegisters & DISASM_OPERAND_REGISTER_INDEX_MASK);
+                if (DISASM_GET_REGISTER_CLS_MASK(type) == 0) type |= DISASM_OPERAND_GENERAL_REG;
+                DisasmRegisterSetAddOperandType(read, type);
+            }
+        }
+    }
+    if (read) DisasmRegisterSetAddClassMasks(read, disasm->implicitlyReadRegisters);
+    if (written) DisasmRegisterSetAddClassMasks(written, disasm->implicitlyWrittenRegisters);
+}
+
 #endif
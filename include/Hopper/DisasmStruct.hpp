@@ -0,0 +1,141 @@
+//
+// Hopper Disassembler SDK
+//
+// (c) Cryptic Apps SARL. All Rights Reserved.
+// https://www.hopperapp.com
+//
+// THIS CODE AND INFORMATION ARE PROVIDED "AS IS" WITHOUT WARRANTY OF ANY
+// KIND, EITHER EXPRESSED OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND/OR FITNESS FOR A
+// PARTICULAR PURPOSE.
+//
+
+#ifndef _HOPPER_DISASM_STRUCT_HPP_
+#define _HOPPER_DISASM_STRUCT_HPP_
+
+// C++ accessors for the operand encoding of DisasmStruct.h.
+// Everything is constexpr, and the register iteration relies on count-trailing-zeros,
+// so that operand walking code compiles to bit instructions instead of loops.
+// This header can be used from C++14 and Objective-C++ plugins.
+
+#include "DisasmStruct.h"
+
+namespace Hopper {
+namespace Disasm {
+
+/// Index of the lowest bit set in "mask", or -1 if no bit is set.
+constexpr int lowestBitIndex(uint64_t mask) {
+    return mask ? __builtin_ctzll(mask) : -1;
+}
+
+constexpr int bitCount(uint64_t mask) {
+    return __builtin_popcountll(mask);
+}
+
+/// Iterates over the indexes of the bits set in a mask, from the lowest to the highest.
+class BitIndexIterator {
+public:
+    constexpr explicit BitIndexIterator(uint64_t mask) : _mask(mask) {}
+
+    constexpr unsigned operator*() const { return (unsigned) __builtin_ctzll(_mask); }
+    constexpr BitIndexIterator &operator++() { _mask &= _mask - 1; return *this; }
+    constexpr bool operator!=(const BitIndexIterator &other) const { return _mask != other._mask; }
+
+private:
+    uint64_t _mask;
+};
+
+/// A mask of register indexes, as found in the lower 32 bits of a DisasmOperandType, or in the
+/// "baseRegistersMask" and "indexRegistersMask" fields of a DisasmMemoryAccess.
+class RegisterIndexMask {
+public:
+    constexpr RegisterIndexMask() : _bits(0) {}
+    constexpr explicit RegisterIndexMask(uint64_t bits) : _bits(bits & DISASM_OPERAND_REGISTER_INDEX_MASK) {}
+
+    static constexpr RegisterIndexMask withIndex(unsigned index) { return RegisterIndexMask(DISASM_BUILD_REGISTER_INDEX_MASK(index)); }
+
+    constexpr uint64_t bits() const { return _bits; }
+    constexpr bool isEmpty() const { return _bits == 0; }
+    constexpr bool contains(unsigned index) const { return (_bits >> index) & 1; }
+    constexpr int count() const { return bitCount(_bits); }
+    /// The lowest index of the mask, or -1 if it is empty.
+    constexpr int first() const { return lowestBitIndex(_bits); }
+
+    constexpr RegisterIndexMask operator|(RegisterIndexMask other) const { return RegisterIndexMask(_bits | other._bits); }
+    constexpr RegisterIndexMask operator&(RegisterIndexMask other) const { return RegisterIndexMask(_bits & other._bits); }
+    constexpr bool operator==(RegisterIndexMask other) const { return _bits == other._bits; }
+    constexpr bool operator!=(RegisterIndexMask other) const { return _bits != other._bits; }
+
+    constexpr BitIndexIterator begin() const { return BitIndexIterator(_bits); }
+    constexpr BitIndexIterator end() const { return BitIndexIterator(0); }
+
+private:
+    uint64_t _bits;
+};
+
+/// A mask of register classes, as found in bits 32 to 47 of a DisasmOperandType.
+/// The mask is stored shifted down, so that bit N stands for the register class N.
+class RegisterClassMask {
+public:
+    constexpr RegisterClassMask() : _bits(0) {}
+    constexpr explicit RegisterClassMask(uint64_t bits) : _bits(bits & 0xFFFF) {}
+
+    static constexpr RegisterClassMask withClass(unsigned cls) { return RegisterClassMask(1llu << cls); }
+
+    constexpr uint64_t bits() const { return _bits; }
+    /// The mask in the DisasmOperandType format.
+    constexpr DisasmOperandType operandBits() const { return _bits << DISASM_MAX_REG_INDEX; }
+    constexpr bool isEmpty() const { return _bits == 0; }
+    constexpr bool contains(unsigned cls) const { return (_bits >> cls) & 1; }
+    constexpr int count() const { return bitCount(_bits); }
+    /// The lowest register class of the mask, or -1 if it is empty.
+    constexpr int first() const { return lowestBitIndex(_bits); }
+
+    constexpr RegisterClassMask operator|(RegisterClassMask other) const { return RegisterClassMask(_bits | other._bits); }
+    constexpr RegisterClassMask operator&(RegisterClassMask other) const { return RegisterClassMask(_bits & other._bits); }
+    constexpr bool operator==(RegisterClassMask other) const { return _bits == other._bits; }
+    constexpr bool operator!=(RegisterClassMask other) const { return _bits != other._bits; }
+
+    constexpr BitIndexIterator begin() const { return BitIndexIterator(_bits); }
+    constexpr BitIndexIterator end() const { return BitIndexIterator(0); }
+
+private:
+    uint64_t _bits;
+};
+
+// Accessors on the "type" field of an operand.
+
+constexpr bool isNoOperand(DisasmOperandType type) { return (type & DISASM_OPERAND_NO_OPERAND) != 0; }
+constexpr bool isConstant(DisasmOperandType type) { return (type & DISASM_OPERAND_CONSTANT_TYPE) != 0; }
+constexpr bool isMemory(DisasmOperandType type) { return (type & DISASM_OPERAND_MEMORY_TYPE) != 0; }
+constexpr bool isRegister(DisasmOperandType type) { return (type & DISASM_OPERAND_REGISTER_TYPE) != 0; }
+constexpr bool isAbsolute(DisasmOperandType type) { return (type & DISASM_OPERAND_ABSOLUTE) != 0; }
+constexpr bool isRelative(DisasmOperandType type) { return (type & DISASM_OPERAND_RELATIVE) != 0; }
+constexpr bool isFloatConstant(DisasmOperandType type) { return (type & DISASM_OPERAND_FLOAT_CONSTANT) != 0; }
+constexpr bool isOther(DisasmOperandType type) { return (type & DISASM_OPERAND_OTHER) != 0; }
+
+constexpr RegisterClassMask registerClasses(DisasmOperandType type) { return RegisterClassMask(DISASM_GET_REGISTER_CLS_MASK(type)); }
+constexpr RegisterIndexMask registerIndexes(DisasmOperandType type) { return RegisterIndexMask(DISASM_GET_REGISTER_INDEX_MASK(type)); }
+
+/// The lowest register class of the operand, or -1 if there is none.
+constexpr int registerClass(DisasmOperandType type) { return lowestBitIndex(DISASM_GET_REGISTER_CLS_MASK(type)); }
+/// The lowest register index of the operand, or -1 if there is none.
+constexpr int registerIndex(DisasmOperandType type) { return lowestBitIndex(DISASM_GET_REGISTER_INDEX_MASK(type)); }
+
+constexpr DisasmOperandType buildRegister(unsigned cls, unsigned index) {
+    return DISASM_OPERAND_REGISTER_TYPE | DISASM_BUILD_REGISTER_MASK(cls, index);
+}
+
+constexpr DisasmOperandType buildRegisters(RegisterClassMask classes, RegisterIndexMask indexes) {
+    return DISASM_OPERAND_REGISTER_TYPE | classes.operandBits() | indexes.bits();
+}
+
+// Accessors on the memory indirection of an operand.
+
+constexpr RegisterIndexMask baseRegisters(const DisasmMemoryAccess &memory) { return RegisterIndexMask(memory.baseRegistersMask); }
+constexpr RegisterIndexMask indexRegisters(const DisasmMemoryAccess &memory) { return RegisterIndexMask(memory.indexRegistersMask); }
+
+} // namespace Disasm
+} // namespace Hopper
+
+#endif
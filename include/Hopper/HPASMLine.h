@@ -12,6 +12,104 @@
 
 #import "CommonTypes.h"
 
+// Tokens
+//
+// A line can also be described by a single UTF-8 buffer, and an array of tokens giving the
+// meaning of each part of the text. This is used by the rendering paths which don't build
+// HPASMLine objects.
+
+HP_BEGIN_DECL_ENUM(uint8_t, ASMTokenKind) {
+    ASMToken_Raw,
+    ASMToken_Mnemonic,
+    ASMToken_JumpMnemonic,
+    ASMToken_Register,          // value: ASM_TOKEN_REGISTER_VALUE(class, index)
+    ASMToken_Number,            // value: the number
+    ASMToken_Address,           // value: the address
+    ASMToken_Name,              // value: the address of the name
+    ASMToken_LocalName,         // value: the address of the name
+    ASMToken_Comment,
+    ASMToken_String
+}
+HP_END_DECL_ENUM(ASMTokenKind);
+
+#define ASM_TOKEN_REGISTER_VALUE(CLS,INDEX)     ((((uint64_t) (CLS)) << 32) | (uint32_t) (INDEX))
+#define ASM_TOKEN_REGISTER_CLASS(VALUE)         ((RegClass) ((VALUE) >> 32))
+#define ASM_TOKEN_REGISTER_INDEX(VALUE)         ((uint32_t) (VALUE))
+
+/// Value of the "operandIndex" field of a token which is not part of an operand.
+#define ASM_TOKEN_NO_OPERAND                    0xFF
+
+typedef struct {
+    ASMTokenKind kind;
+    /// Index of the operand the token belongs to, or ASM_TOKEN_NO_OPERAND.
+    uint8_t      operandIndex;
+    /// Length of the token text, in bytes.
+    uint16_t     length;
+    /// Offset of the token text in the UTF-8 buffer, in bytes.
+    uint32_t     offset;
+    uint64_t     value;
+} ASMToken;
+
+/// A caller-provided UTF-8 buffer, and token array. The lengths and counts are incremented even when the
+/// capacities are exceeded, so that the caller can detect the overflow and try again with larger buffers.
+/// The text is always NUL terminated, when "textCapacity" is not 0. Use ASMTokenBufferInit to set up a buffer.
+typedef struct {
+    char     *text;
+    size_t    textCapacity;
+    size_t    textLength;
+
+    ASMToken *tokens;
+    size_t    tokenCapacity;
+    size_t    tokenCount;
+} ASMTokenBuffer;
+
+static inline void ASMTokenBufferInit(ASMTokenBuffer * _Nonnull buffer, char * _Nullable text, size_t textCapacity, ASMToken * _Nullable tokens, size_t tokenCapacity) {
+    buffer->text = text;
+    buffer->textCapacity = textCapacity;
+    buffer->textLength = 0;
+    buffer->tokens = tokens;
+    buffer->tokenCapacity = tokenCapacity;
+    buffer->tokenCount = 0;
+    if (textCapacity) text[0] = 0;
+}
+
+static inline void ASMTokenBufferAppend(ASMTokenBuffer * _Nonnull buffer, ASMTokenKind kind, uint8_t operandIndex, const char * _Nonnull text, size_t length, uint64_t value) {
+    size_t offset = buffer->textLength;
+    if (offset < buffer->textCapacity) {
+        size_t available = buffer->textCapacity - 1 - offset;
+        memcpy(buffer->text + offset, text, length < available ? length : available);
+        buffer->text[offset + (length < available ? length : available)] = 0;
+    }
+    buffer->textLength += length;
+
+    // Consecutive raw parts of the same operand are merged.
+    if (kind == ASMToken_Raw && buffer->tokenCount > 0 && buffer->tokenCount <= buffer->tokenCapacity) {
+        ASMToken *last = buffer->tokens + buffer->tokenCount - 1;
+        if (last->kind == ASMToken_Raw && last->operandIndex == operandIndex && last->offset + last->length == offset && last->length + length <= UINT16_MAX) {
+            last->length += length;
+            return;
+        }
+    }
+
+    if (buffer->tokenCount < buffer->tokenCapacity) {
+        ASMToken *token = buffer->tokens + buffer->tokenCount;
+        token->kind = kind;
+        token->operandIndex = operandIndex;
+        token->length = (uint16_t) length;
+        token->offset = (uint32_t) offset;
+        token->value = value;
+    }
+    buffer->tokenCount++;
+}
+
+static inline void ASMTokenBufferAppendCString(ASMTokenBuffer * _Nonnull buffer, ASMTokenKind kind, uint8_t operandIndex, const char * _Nonnull text, uint64_t value) {
+    ASMTokenBufferAppend(buffer, kind, operandIndex, text, strlen(text), value);
+}
+
+static inline BOOL ASMTokenBufferOverflowed(const ASMTokenBuffer * _Nonnull buffer) {
+    return (buffer->textLength >= buffer->textCapacity) || (buffer->tokenCount > buffer->tokenCapacity);
+}
+
 @protocol HPASMLine
 
 - (NSUInteger)length;
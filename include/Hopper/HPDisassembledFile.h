@@ -87,6 +87,10 @@ typedef void (^FileLoadingCallbackInfo)(NSString * _Nonnull desc, float progress
 - (nullable NSString *)nameForVirtualAddress:(Address)virtualAddress;
 - (nullable NSString *)nearestNameBeforeVirtualAddress:(Address)virtualAddress;
 - (void)setName:(nullable NSString *)name forVirtualAddress:(Address)virtualAddress reason:(NameCreationReason)reason;
+/// Name "count" addresses at once: names[i] is given to addresses[i]. The names are applied as a single transaction,
+/// with a single update of the name index, a single undo step, and a single refresh of the user interface.
+/// Loaders which import many symbols should use this method instead of "setName:forVirtualAddress:reason:".
+- (void)setNames:(nonnull NSArray<NSString *> *)names forAddresses:(nonnull const Address *)addresses count:(NSUInteger)count reason:(NameCreationReason)reason;
 - (Address)findVirtualAddressNamed:(nonnull NSString *)name;
 
 // Comments
@@ -96,6 +100,9 @@ typedef void (^FileLoadingCallbackInfo)(NSString * _Nonnull desc, float progress
 - (nullable NSString *)inlineCommentAtVirtualAddress:(Address)virtualAddress;
 - (void)setComment:(nullable NSString *)comment atVirtualAddress:(Address)virtualAddress reason:(CommentCreationReason)reason;
 - (void)setInlineComment:(nullable NSString *)comment atVirtualAddress:(Address)virtualAddress reason:(CommentCreationReason)reason;
+/// Bulk variants of the two methods above, applied as a single transaction, like "setNames:forAddresses:count:reason:".
+- (void)setComments:(nonnull NSArray<NSString *> *)comments atAddresses:(nonnull const Address *)addresses count:(NSUInteger)count reason:(CommentCreationReason)reason;
+- (void)setInlineComments:(nonnull NSArray<NSString *> *)comments atAddresses:(nonnull const Address *)addresses count:(NSUInteger)count reason:(CommentCreationReason)reason;
 
 // Types
 - (BOOL)typeCanBeModifiedAtAddress:(Address)va;
@@ -149,6 +156,7 @@ typedef void (^FileLoadingCallbackInfo)(NSString * _Nonnull desc, float progress
 
 // Assembler
 - (nullable NSData *)assembleInstruction:(nonnull NSString *)instr atAddress:(Address)address withCPUMode:(uint8_t)cpuMode usingSyntaxVariant:(NSUInteger)syntax isRawData:(nonnull BOOL *)isRawData error:(NSError * _Nonnull * _Nonnull)error;
+/// Uses the "nopPatternForMode:" method of the CPU when it is implemented.
 - (nullable NSData *)nopDataForRegion:(AddressRange)range;
 
 // Reading file
@@ -171,6 +179,17 @@ typedef void (^FileLoadingCallbackInfo)(NSString * _Nonnull desc, float progress
 
 - (nullable NSString *)readCStringAt:(Address)address;
 
+/// Returns the mapped bytes of a range, without copying them. The span stops at the end of the mapped data of
+/// the segment which contains "range.from", so its length may be lower than "range.len", or 0 if the start of the
+/// range is not mapped. The bytes stay valid until the next modification of the file (a write, a new segment…).
+- (ByteSpan)bytesInRange:(AddressRange)range;
+
+/// Decode "count" consecutive integers starting at "virtualAddress", with the given endianess, into "values".
+/// Returns the number of values decoded, which is lower than "count" if the mapped data ends before.
+- (NSUInteger)readUInt16s:(nonnull uint16_t *)values count:(NSUInteger)count atVirtualAddress:(Address)virtualAddress endianess:(CPUEndianess)endianess;
+- (NSUInteger)readUInt32s:(nonnull uint32_t *)values count:(NSUInteger)count atVirtualAddress:(Address)virtualAddress endianess:(CPUEndianess)endianess;
+- (NSUInteger)readUInt64s:(nonnull uint64_t *)values count:(NSUInteger)count atVirtualAddress:(Address)virtualAddress endianess:(CPUEndianess)endianess;
+
 // Misc
 - (BOOL)hasMappedDataAt:(Address)address;
 - (Address)parseAddressString:(nonnull NSString *)addressString;
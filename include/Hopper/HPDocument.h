@@ -75,6 +75,8 @@ typedef void (^CancelBlock)(void);
 
 - (nullable NSString *)readCStringAt:(Address)virtualAddress;
 
+/// After a write, the "bytesChangedInRange:" method of the CPU contexts of the file is called with the written
+/// range: a context must drop any state derived from those bytes.
 - (BOOL)writeInt8:(int8_t)value atVirtualAddress:(Address)virtualAddress;
 - (BOOL)writeInt16:(int16_t)value atVirtualAddress:(Address)virtualAddress;
 - (BOOL)writeInt32:(int32_t)value atVirtualAddress:(Address)virtualAddress;
@@ -11,6 +11,7 @@
 //
 
 #import "CommonTypes.h"
+#import "HPASMLine.h"
 
 @protocol HPHopperUUID;
 @protocol HPASMLine;
@@ -51,6 +52,12 @@
 - (nonnull NSObject<HPASMLine> *)lineWithFormattedNumber:(nonnull NSString *)string withValue:(nonnull NSNumber *)number;
 - (nonnull NSObject<HPASMLine> *)lineWithFormattedAddress:(nonnull NSString *)string withValue:(Address)address;
 
+/// Build a line in a single call, from a UTF-8 text and the tokens describing it, as filled by the
+/// "renderOperand:…" methods of CPUContext. Tokens which belong to an operand are flagged as such,
+/// and names are substituted to the ASMToken_Address tokens the same way "formatNumber:…" does.
+- (nonnull NSObject<HPASMLine> *)lineWithUTF8Text:(nonnull const char *)text length:(size_t)length tokens:(nonnull const ASMToken *)tokens count:(NSUInteger)count;
+- (nonnull NSObject<HPASMLine> *)lineWithTokenBuffer:(nonnull const ASMTokenBuffer *)buffer;
+
 // Options for loaders
 - (nonnull NSObject<HPLoaderOptionComponents> *)addressComponentWithLabel:(nonnull NSString *)label;
 - (nonnull NSObject<HPLoaderOptionComponents> *)checkboxComponentWithLabel:(nonnull NSString *)label;
@@ -64,4 +71,11 @@
 - (nullable NSObject<HPCallDestination> *)callDestination:(Address)address;
 - (nullable NSObject<HPCallDestination> *)callDestination:(Address)address withCPUMode:(uint8_t)cpuMode;
 
+@optional
+
+/// YES if Hopper only reads the "mnemonic" field of a DisasmStruct after a call to "buildMnemonicString:inFile:".
+/// A CPU plugin which sets the "instructionID" field can then leave the mnemonic empty during the decoding.
+/// Hopper versions which do not implement this method need the mnemonic right after the decoding.
+- (BOOL)supportsLazyMnemonics;
+
 @end
@@ -0,0 +1,122 @@
+//
+// Hopper Disassembler SDK
+//
+// (c) Cryptic Apps SARL. All Rights Reserved.
+// https://www.hopperapp.com
+//
+// THIS CODE AND INFORMATION ARE PROVIDED "AS IS" WITHOUT WARRANTY OF ANY
+// KIND, EITHER EXPRESSED OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND/OR FITNESS FOR A
+// PARTICULAR PURPOSE.
+//
+
+#ifndef _HOPPER_SEGMENT_CURSOR_H_
+#define _HOPPER_SEGMENT_CURSOR_H_
+
+#import "CommonTypes.h"
+#import "HPDisassembledFile.h"
+#import "HPSegment.h"
+#import "HPSection.h"
+
+// Segment cursor
+//
+// The "read…AtVirtualAddress:" methods of HPDisassembledFile resolve the segment of the address for each value.
+// A cursor resolves it once, and keeps a pointer to its mapped bytes, so that sequential decoders read the
+// following values inline, with a single bounds check. A cursor is valid until the next modification of the
+// file, like the spans returned by "bytesInRange:". It doesn't retain the segment, which is owned by the file.
+
+typedef struct {
+    __unsafe_unretained NSObject<HPSegment> * _Nullable segment;
+    /// Mapped bytes of the segment, from "start" (included) to "end" (excluded).
+    const uint8_t * _Nullable bytes;
+    Address                   start;
+    Address                   end;
+    CPUEndianess              endianess;
+
+    /// Last section returned by HPSegmentCursorSectionAt, and its bounds, end excluded.
+    __unsafe_unretained NSObject<HPSection> * _Nullable lastSection;
+    Address                   lastSectionStart;
+    Address                   lastSectionEnd;
+} SegmentCursor;
+
+/// Pin the segment which contains "address". Returns NO, and leaves an empty cursor, if no segment contains it.
+static inline BOOL HPSegmentCursorInit(SegmentCursor * _Nonnull cursor, NSObject<HPDisassembledFile> * _Nonnull file, Address address, CPUEndianess endianess) {
+    memset(cursor, 0, sizeof(SegmentCursor));
+    cursor->endianess = endianess;
+
+    NSObject<HPSegment> *segment = [file segmentForVirtualAddress:address];
+    if (segment == nil) return NO;
+
+    cursor->segment = segment;
+    cursor->start = cursor->end = [segment startAddress];
+    Address mappedEnd = [segment endMappedDataAddress];
+    if (mappedEnd > cursor->start) {
+        ByteSpan span = [file bytesInRange:(AddressRange) { cursor->start, (size_t) (mappedEnd - cursor->start) }];
+        cursor->bytes = span.bytes;
+        cursor->end = cursor->start + span.length;
+    }
+    return YES;
+}
+
+/// Returns YES if the "size" bytes at "address" are mapped bytes of the pinned segment.
+static inline BOOL HPSegmentCursorContains(const SegmentCursor * _Nonnull cursor, Address address, size_t size) {
+    return address >= cursor->start && size <= cursor->end - cursor->start && address - cursor->start <= cursor->end - cursor->start - size;
+}
+
+/// Read an integer of "size" bytes, at most 8, in the endianess of the cursor.
+/// Returns NO, and leaves "value" untouched, if the bytes are not in the pinned segment.
+static inline BOOL HPSegmentCursorRead(const SegmentCursor * _Nonnull cursor, Address address, size_t size, uint64_t * _Nonnull value) {
+    if (!HPSegmentCursorContains(cursor, address, size)) return NO;
+    const uint8_t *p = cursor->bytes + (address - cursor->start);
+    uint64_t v = 0;
+    if (cursor->endianess == CPUEndianess_Big) {
+        for (size_t i=0; i<size; i++) v = (v << 8) | p[i];
+    }
+    else {
+        for (size_t i=size; i>0; i--) v = (v << 8) | p[i - 1];
+    }
+    *value = v;
+    return YES;
+}
+
+static inline BOOL HPSegmentCursorReadUInt8(const SegmentCursor * _Nonnull cursor, Address address, uint8_t * _Nonnull value) {
+    if (!HPSegmentCursorContains(cursor, address, 1)) return NO;
+    *value = cursor->bytes[address - cursor->start];
+    return YES;
+}
+
+static inline BOOL HPSegmentCursorReadUInt16(const SegmentCursor * _Nonnull cursor, Address address, uint16_t * _Nonnull value) {
+    uint64_t v;
+    if (!HPSegmentCursorRead(cursor, address, 2, &v)) return NO;
+    *value = (uint16_t) v;
+    return YES;
+}
+
+static inline BOOL HPSegmentCursorReadUInt32(const SegmentCursor * _Nonnull cursor, Address address, uint32_t * _Nonnull value) {
+    uint64_t v;
+    if (!HPSegmentCursorRead(cursor, address, 4, &v)) return NO;
+    *value = (uint32_t) v;
+    return YES;
+}
+
+static inline BOOL HPSegmentCursorReadUInt64(const SegmentCursor * _Nonnull cursor, Address address, uint64_t * _Nonnull value) {
+    return HPSegmentCursorRead(cursor, address, 8, value);
+}
+
+/// Same result as the "sectionForVirtualAddress:" method of the file, but the last section found is kept in the
+/// cursor, and returned without a lookup while the addresses stay in it.
+static inline NSObject<HPSection> * _Nullable HPSegmentCursorSectionAt(SegmentCursor * _Nonnull cursor, NSObject<HPDisassembledFile> * _Nonnull file, Address address) {
+    if (cursor->lastSection != nil && address >= cursor->lastSectionStart && address < cursor->lastSectionEnd) {
+        return cursor->lastSection;
+    }
+
+    NSObject<HPSection> *section = [file sectionForVirtualAddress:address];
+    if (section != nil) {
+        cursor->lastSection = section;
+        cursor->lastSectionStart = [section startAddress];
+        cursor->lastSectionEnd = cursor->lastSectionStart + [section length];
+    }
+    return section;
+}
+
+#endif
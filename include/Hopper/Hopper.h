@@ -19,6 +19,7 @@
 #import "HPDisassembledFile.h"
 #import "HPSegment.h"
 #import "HPSection.h"
+#import "HPSegmentCursor.h"
 #import "HPProcedure.h"
 #import "HPBasicBlock.h"
 #import "HPTag.h"